@@ -1,7 +1,14 @@
 ﻿#include "ChemistryVars.h"
 #include "ChemistryIO.h"
+#include "MechanismAnalytics.h"
+#include "ReactionIndex.h"
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <set>
 #include <sstream>
+#include <stdexcept>
 
 // 解析动力学数据并返回结构化结果
 std::vector<ChemistryVars::ReactionData> ChemistryVars::extractKinetics(const std::string& yamlFile, bool verbose) {
@@ -724,6 +731,38 @@ std::vector<ChemistryVars::ThermoData> ChemistryVars::extractThermo(const std::s
                         validNASA7Count++;
                         if (verbose) std::cout << "    NASA7数据完整有效" << std::endl;
                     }
+
+                    // 标准格式的NASA9数据: temperature-ranges有n+1个点, data有n组9个系数
+                    if (thermoItem.model == "NASA9" && thermo.count("data") && thermo.at("data").isSequence()) {
+                        const auto& dataArray = thermo.at("data").asSequence();
+                        thermoItem.nasa9Coeffs.clear();
+
+                        for (size_t j = 0; j < dataArray.size() && j + 1 < thermoItem.temperatureRanges.size(); j++) {
+                            ThermoData::NASA9Range nasa9Range;
+                            nasa9Range.temperatureRange.push_back(thermoItem.temperatureRanges[j]);
+                            nasa9Range.temperatureRange.push_back(thermoItem.temperatureRanges[j + 1]);
+                            if (dataArray[j].isSequence()) {
+                                for (const auto& coeff : dataArray[j].asSequence()) {
+                                    try {
+                                        nasa9Range.coefficients.push_back(coeff.asNumber());
+                                    }
+                                    catch (const std::exception&) {
+                                        if (verbose) std::cout << "[格式错误] ";
+                                    }
+                                }
+                            }
+                            if (nasa9Range.coefficients.size() != 9 && verbose) {
+                                std::cerr << "    警告: NASA9模型需要9个系数，区间 #" << (j + 1) << " 实际有 "
+                                    << nasa9Range.coefficients.size() << std::endl;
+                            }
+                            thermoItem.nasa9Coeffs.push_back(nasa9Range);
+                        }
+
+                        // NASA9系数不能按NASA7低温/高温系数使用
+                        thermoItem.coefficients.low.clear();
+                        thermoItem.coefficients.high.clear();
+                        if (verbose) std::cout << "    NASA9温度区间数: " << thermoItem.nasa9Coeffs.size() << std::endl;
+                    }
                 }
 
                 // NASA-9多项式格式支持
@@ -996,10 +1035,239 @@ ChemistryVars::MechanismData ChemistryVars::loadMechanism(const std::string& yam
     mechanism.reactions = extractKinetics(yamlFile, verbose);
     mechanism.thermoSpecies = extractThermo(yamlFile, verbose);
     mechanism.transportSpecies = extractTransport(yamlFile, verbose);
+    mechanism.units = extractUnits(yamlFile);
 
     return mechanism;
 }
 
+std::map<std::string, std::string> ChemistryVars::extractUnits(const std::string& yamlFile) {
+    std::map<std::string, std::string> units;
+    try {
+        ChemistryIO::YamlValue doc = ChemistryIO::loadFile(yamlFile);
+        if (!doc.isMap() || !doc.asMap().count("units") || !doc.asMap().at("units").isMap()) {
+            return units;
+        }
+        for (const auto& pair : doc.asMap().at("units").asMap()) {
+            if (pair.second.isString()) units[pair.first] = pair.second.asString();
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << "读取units失败: " << e.what() << std::endl;
+    }
+    return units;
+}
+
+// 以能精确还原的最短形式格式化浮点数
+static std::string formatNumber(double value) {
+    char buf[32];
+    for (int precision = 10; precision <= 17; ++precision) {
+        std::snprintf(buf, sizeof(buf), "%.*g", precision, value);
+        if (std::strtod(buf, nullptr) == value) break;
+    }
+    std::string text(buf);
+    // 保证写出的是浮点数 (如 "2" -> "2.0")
+    if (text.find_first_of(".eEn") == std::string::npos) text += ".0";
+    return text;
+}
+
+static void emitNumbers(YAML::Emitter& out, const std::vector<double>& values) {
+    out << YAML::Flow << YAML::BeginSeq;
+    for (double v : values) out << formatNumber(v);
+    out << YAML::EndSeq;
+}
+
+static void emitArrhenius(YAML::Emitter& out, const std::string& key, double A, double b, double Ea) {
+    out << YAML::Key << key << YAML::Value << YAML::Flow << YAML::BeginMap
+        << YAML::Key << "A" << YAML::Value << formatNumber(A)
+        << YAML::Key << "b" << YAML::Value << formatNumber(b)
+        << YAML::Key << "Ea" << YAML::Value << formatNumber(Ea)
+        << YAML::EndMap;
+}
+
+static void emitSpeciesMap(YAML::Emitter& out, const std::string& key, const std::map<std::string, double>& values) {
+    out << YAML::Key << key << YAML::Value << YAML::Flow << YAML::BeginMap;
+    for (const auto& pair : values) {
+        out << YAML::Key << pair.first << YAML::Value << formatNumber(pair.second);
+    }
+    out << YAML::EndMap;
+}
+
+// 写出机理数据
+void ChemistryVars::writeMechanism(const MechanismData& mechanism, const std::string& yamlFile,
+    const std::string& phaseName) {
+    // 元素按首次出现的顺序收集
+    std::vector<std::string> elements;
+    std::set<std::string> seenElements;
+    for (const auto& thermo : mechanism.thermoSpecies) {
+        for (const auto& elem : thermo.composition) {
+            if (seenElements.insert(elem.first).second) elements.push_back(elem.first);
+        }
+    }
+
+    std::map<std::string, const TransportData*> transportByName;
+    for (const auto& transport : mechanism.transportSpecies) {
+        transportByName[transport.name] = &transport;
+    }
+
+    YAML::Emitter out;
+    out << YAML::BeginMap;
+
+    // 速率参数按原单位保存, 写出读入时的units (没有时为Cantera的默认输入单位)
+    std::map<std::string, std::string> units = mechanism.units;
+    if (units.empty()) {
+        units = { { "length", "cm" }, { "time", "s" }, { "quantity", "mol" }, { "activation-energy", "cal/mol" } };
+    }
+    out << YAML::Key << "units" << YAML::Value << YAML::Flow << YAML::BeginMap;
+    for (const auto& pair : units) {
+        out << YAML::Key << pair.first << YAML::Value << pair.second;
+    }
+    out << YAML::EndMap;
+
+    // 相定义
+    out << YAML::Key << "phases" << YAML::Value << YAML::BeginSeq << YAML::BeginMap;
+    out << YAML::Key << "name" << YAML::Value << phaseName;
+    out << YAML::Key << "thermo" << YAML::Value << "ideal-gas";
+    out << YAML::Key << "elements" << YAML::Value << YAML::Flow << elements;
+    out << YAML::Key << "species" << YAML::Value << YAML::Flow << YAML::BeginSeq;
+    for (const auto& thermo : mechanism.thermoSpecies) out << thermo.name;
+    out << YAML::EndSeq;
+    if (!mechanism.reactions.empty()) {
+        out << YAML::Key << "kinetics" << YAML::Value << "gas";
+    }
+    if (!mechanism.transportSpecies.empty()) {
+        out << YAML::Key << "transport" << YAML::Value << "mixture-averaged";
+    }
+    out << YAML::EndMap << YAML::EndSeq;
+
+    // 组分
+    out << YAML::Key << "species" << YAML::Value << YAML::BeginSeq;
+    for (const auto& thermo : mechanism.thermoSpecies) {
+        out << YAML::BeginMap;
+        out << YAML::Key << "name" << YAML::Value << thermo.name;
+        emitSpeciesMap(out, "composition", thermo.composition);
+
+        out << YAML::Key << "thermo" << YAML::Value << YAML::BeginMap;
+        if (!thermo.model.empty()) {
+            out << YAML::Key << "model" << YAML::Value << thermo.model;
+        }
+        if (!thermo.temperatureRanges.empty()) {
+            out << YAML::Key << "temperature-ranges" << YAML::Value;
+            emitNumbers(out, thermo.temperatureRanges);
+        }
+        // 标准格式读入的NASA9数据按原格式写回 (每个区间一组系数)
+        bool nasa9Data = thermo.model == "NASA9" && thermo.coefficients.low.empty() &&
+            !thermo.nasa9Coeffs.empty() && thermo.temperatureRanges.size() == thermo.nasa9Coeffs.size() + 1;
+        out << YAML::Key << "data" << YAML::Value << YAML::BeginSeq;
+        if (nasa9Data) {
+            for (const auto& range : thermo.nasa9Coeffs) emitNumbers(out, range.coefficients);
+        }
+        if (!thermo.coefficients.low.empty()) emitNumbers(out, thermo.coefficients.low);
+        if (!thermo.coefficients.high.empty()) emitNumbers(out, thermo.coefficients.high);
+        out << YAML::EndSeq;
+        out << YAML::EndMap;
+
+        if (!nasa9Data && !thermo.nasa9Coeffs.empty()) {
+            out << YAML::Key << "nasa9-coeffs" << YAML::Value << YAML::BeginSeq;
+            for (const auto& range : thermo.nasa9Coeffs) {
+                out << YAML::BeginMap;
+                out << YAML::Key << "T-range" << YAML::Value;
+                emitNumbers(out, range.temperatureRange);
+                out << YAML::Key << "coeffs" << YAML::Value;
+                emitNumbers(out, range.coefficients);
+                out << YAML::EndMap;
+            }
+            out << YAML::EndSeq;
+        }
+
+        auto it = transportByName.find(thermo.name);
+        if (it != transportByName.end()) {
+            const TransportData& tr = *it->second;
+            out << YAML::Key << "transport" << YAML::Value << YAML::BeginMap;
+            if (!tr.model.empty()) out << YAML::Key << "model" << YAML::Value << tr.model;
+            if (!tr.geometry.empty()) out << YAML::Key << "geometry" << YAML::Value << tr.geometry;
+            out << YAML::Key << "well-depth" << YAML::Value << formatNumber(tr.wellDepth);
+            out << YAML::Key << "diameter" << YAML::Value << formatNumber(tr.diameter);
+            if (tr.dipole != 0.0) out << YAML::Key << "dipole" << YAML::Value << formatNumber(tr.dipole);
+            if (tr.polarizability != 0.0) {
+                out << YAML::Key << "polarizability" << YAML::Value << formatNumber(tr.polarizability);
+            }
+            if (tr.rotationalRelaxation != 0.0) {
+                out << YAML::Key << "rotational-relaxation" << YAML::Value << formatNumber(tr.rotationalRelaxation);
+            }
+            if (!tr.note.empty()) out << YAML::Key << "note" << YAML::Value << tr.note;
+            out << YAML::EndMap;
+        }
+        out << YAML::EndMap;
+    }
+    out << YAML::EndSeq;
+
+    // 反应
+    out << YAML::Key << "reactions" << YAML::Value << YAML::BeginSeq;
+    for (const auto& reaction : mechanism.reactions) {
+        bool plog = reaction.rateConstant.isPressureDependent;
+        // 带PLOG note的falloff反应在读取时类型被改写, 由低压参数判断
+        bool falloff = reaction.type == "falloff" || reaction.type == "chemically-activated" ||
+            reaction.lowPressure.A != 0.0;
+
+        out << YAML::BeginMap;
+        out << YAML::Key << "equation" << YAML::Value << reaction.equation;
+        // PLOG类型由note推断, 不单独写出
+        if (!plog && !reaction.type.empty()) {
+            out << YAML::Key << "type" << YAML::Value << reaction.type;
+        }
+        else if (plog && falloff) {
+            out << YAML::Key << "type" << YAML::Value << "falloff";
+        }
+        if (falloff) {
+            emitArrhenius(out, "low-P-rate-constant",
+                reaction.lowPressure.A, reaction.lowPressure.b, reaction.lowPressure.Ea);
+            emitArrhenius(out, "high-P-rate-constant",
+                reaction.rateConstant.A, reaction.rateConstant.b, reaction.rateConstant.Ea);
+            const auto& troe = reaction.troe;
+            if (troe.a != 0.0 || troe.T_star != 0.0 || troe.T_double_star != 0.0 || troe.T_triple_star != 0.0) {
+                out << YAML::Key << "Troe" << YAML::Value << YAML::Flow << YAML::BeginMap
+                    << YAML::Key << "A" << YAML::Value << formatNumber(troe.a)
+                    << YAML::Key << "T3" << YAML::Value << formatNumber(troe.T_star)
+                    << YAML::Key << "T1" << YAML::Value << formatNumber(troe.T_double_star);
+                if (troe.T_triple_star != 0.0) {
+                    out << YAML::Key << "T2" << YAML::Value << formatNumber(troe.T_triple_star);
+                }
+                out << YAML::EndMap;
+            }
+        }
+        else {
+            emitArrhenius(out, "rate-constant",
+                reaction.rateConstant.A, reaction.rateConstant.b, reaction.rateConstant.Ea);
+        }
+        if (!reaction.efficiencies.empty()) emitSpeciesMap(out, "efficiencies", reaction.efficiencies);
+        if (reaction.isDuplicate) out << YAML::Key << "duplicate" << YAML::Value << true;
+        if (!reaction.orders.empty()) emitSpeciesMap(out, "orders", reaction.orders);
+
+        // PLOG数据按输入文件的note格式写出
+        if (plog) {
+            std::string note;
+            for (const auto& p : reaction.rateConstant.plogData) {
+                note += "PLOG/ " + formatNumber(p.pressure) + " " + formatNumber(p.A) + " " +
+                    formatNumber(p.b) + " " + formatNumber(p.Ea) + "/\n";
+            }
+            out << YAML::Key << "note" << YAML::Value << YAML::Literal << note;
+        }
+        out << YAML::EndMap;
+    }
+    out << YAML::EndSeq;
+    out << YAML::EndMap;
+
+    if (!out.good()) {
+        throw std::runtime_error("YAML emitter error: " + out.GetLastError());
+    }
+
+    std::ofstream file(yamlFile);
+    if (!file) {
+        throw std::runtime_error("Cannot open file for writing: " + yamlFile);
+    }
+    file << out.c_str() << std::endl;
+}
+
 // 保留原有的分析函数 - 直接调用extract函数并显示
 void ChemistryVars::analyzeKinetics(const std::string& yamlFile) {
     extractKinetics(yamlFile, true);
@@ -1097,11 +1365,43 @@ void ChemistryVars::printMechanismSummary(const std::string& yamlFile, bool prin
 
 // 处理和分析已加载的机理数据
 void ChemistryVars::analyzeMechanism(const MechanismData& mechanism, bool printDetails, int maxReactions) {
+    // 方程式只解析一次, 统计结果由一次线性扫描得到
+    ReactionIndex index(mechanism.reactions);
+    MechanismAnalytics::Report report = MechanismAnalytics::analyze(mechanism, index);
+
     // 打印基本摘要信息
     std::cout << "成功加载机理数据:" << std::endl;
-    std::cout << "  " << mechanism.reactions.size() << " 个反应" << std::endl;
-    std::cout << "  " << mechanism.thermoSpecies.size() << " 个组分热力学数据" << std::endl;
-    std::cout << "  " << mechanism.transportSpecies.size() << " 个组分输运性质数据" << std::endl;
+    std::cout << "  " << report.nReactions << " 个反应" << std::endl;
+    std::cout << "  " << report.nSpecies << " 个组分热力学数据" << std::endl;
+    std::cout << "  " << report.nTransport << " 个组分输运性质数据" << std::endl;
+
+    std::cout << "  反应类型:";
+    for (const auto& entry : report.typeHistogram) {
+        std::cout << " " << entry.first << "=" << entry.second;
+    }
+    std::cout << std::endl;
+    std::cout << "  可逆反应 " << report.nReversible << " 个, 复制反应 " << report.nDuplicate
+        << " 个, PLOG反应 " << report.nPlog << " 个" << std::endl;
+
+    for (const auto& imbalance : report.imbalances) {
+        std::cout << "  [警告] 元素 " << imbalance.element << " 不守恒: "
+            << mechanism.reactions[imbalance.reaction].equation << " (差值 " << imbalance.delta << ")" << std::endl;
+    }
+    for (const auto& unknown : report.unknownSpecies) {
+        std::cout << "  [警告] 未定义的组分 " << unknown.name << ": "
+            << mechanism.reactions[unknown.reaction].equation << std::endl;
+    }
+    for (const auto& issue : report.duplicateIssues) {
+        std::cout << "  [警告] 重复反应标记不一致: " << issue.equation << std::endl;
+    }
+    if (!report.unreferencedSpecies.empty()) {
+        std::cout << "  未被任何反应引用的组分:";
+        for (const auto& name : report.unreferencedSpecies) std::cout << " " << name;
+        std::cout << std::endl;
+    }
+    if (!report.elementError.empty()) {
+        std::cout << "  [警告] " << report.elementError << std::endl;
+    }
 
     // 如果不需要打印详细信息，直接返回
     if (!printDetails) {
@@ -1110,7 +1410,8 @@ void ChemistryVars::analyzeMechanism(const MechanismData& mechanism, bool printD
 
     // 遍历并访问所有反应的数据
     int count = 0;
-    for (const auto& reaction : mechanism.reactions) {
+    for (size_t i = 0; i < mechanism.reactions.size(); ++i) {
+        const auto& reaction = mechanism.reactions[i];
         std::cout << "反应: " << reaction.equation << std::endl;
 
         // 显示反应类型
@@ -1118,9 +1419,9 @@ void ChemistryVars::analyzeMechanism(const MechanismData& mechanism, bool printD
             std::cout << "  反应类型: " << reaction.type << std::endl;
         }
 
-        // 解析反应方程式获取化学计量数
-        std::map<std::string, double> reactants, products;
-        parseReactionEquation(reaction.equation, reactants, products);
+        // 已解析的化学计量数
+        const auto& reactants = index.stoichiometry(i).reactants;
+        const auto& products = index.stoichiometry(i).products;
 
         // 打印反应物及其化学计量数
         std::cout << "  反应物:" << std::endl;
@@ -9,6 +9,14 @@ class ChemistryVars {
 public:
     // 反应数据结构
     struct ReactionData {
+        // PLOG数据点 (唯一的PLOG存储为 rateConstant.plogData)
+        struct PLOGPoint {
+            double pressure;  // atm
+            double A;
+            double b;
+            double Ea;
+        };
+
         std::string equation;
         std::string type;
 
@@ -21,13 +29,6 @@ public:
             std::string Ea_units;
 
             // PLOG支持
-            struct PLOGPoint {
-                double pressure;  // atm
-                double A;
-                double b;
-                double Ea;
-            };
-
             bool isPressureDependent = false;
             std::vector<PLOGPoint> plogData;
         } rateConstant;
@@ -52,17 +53,6 @@ public:
 
         bool isDuplicate = false;
         std::map<std::string, double> orders;
-
-        // PLOG支持
-        struct PLOGPoint {
-            double pressure;  // atm
-            double A;
-            double b;
-            double Ea;
-        };
-
-        bool isPressureDependent = false;
-        std::vector<PLOGPoint> plogData;
     };
 
     // 热力学数据结构
@@ -105,14 +95,22 @@ public:
         std::vector<ReactionData> reactions;
         std::vector<ThermoData> thermoSpecies;
         std::vector<TransportData> transportSpecies;
+        // 文件顶层的units (如 length: cm, activation-energy: cal/mol); 速率参数按原单位保存, 不做换算
+        std::map<std::string, std::string> units;
     };
 
     
     static std::vector<ReactionData> extractKinetics(const std::string& yamlFile, bool verbose = false);
     static std::vector<ThermoData> extractThermo(const std::string& yamlFile, bool verbose = false);
     static std::vector<TransportData> extractTransport(const std::string& yamlFile, bool verbose = false);
+    static std::map<std::string, std::string> extractUnits(const std::string& yamlFile);
     static MechanismData loadMechanism(const std::string& yamlFile, bool verbose = false);
 
+    // 将机理数据写为YAML文件 (Cantera格式, 可被loadMechanism重新读取), 失败时抛出异常
+    // units按mechanism.units写出 (为空时写Cantera的默认输入单位 cm, s, mol, cal/mol)
+    static void writeMechanism(const MechanismData& mechanism, const std::string& yamlFile,
+        const std::string& phaseName = "gas");
+
     // 分析和打印函数
     static void analyzeKinetics(const std::string& yamlFile);
     static void analyzeThermo(const std::string& yamlFile);
@@ -0,0 +1,252 @@
+#include "CompactReactions.h"
+#include <stdexcept>
+
+namespace {
+
+const std::string kTypeNames[] = {
+    "", "three-body", "falloff", "chemically-activated", "pressure-dependent-Arrhenius", ""
+};
+const std::string kElementary = "elementary";
+
+// std::string 的堆上字节数 (短字符串优化时为0)
+size_t heapBytes(const std::string& s) {
+    return s.capacity() > 15 ? s.capacity() + 1 : 0;
+}
+
+size_t heapBytes(const std::map<std::string, double>& m) {
+    // 红黑树节点: 3个指针 + 颜色 + 键值对
+    size_t bytes = 0;
+    for (const auto& entry : m) {
+        bytes += 4 * sizeof(void*) + sizeof(entry) + heapBytes(entry.first);
+    }
+    return bytes;
+}
+
+} // namespace
+
+CompactReactions::Type CompactReactions::typeFromString(const std::string& type) {
+    if (type.empty() || type == "elementary") return Type::Elementary;
+    if (type == "three-body") return Type::ThreeBody;
+    if (type == "falloff") return Type::Falloff;
+    if (type == "chemically-activated") return Type::ChemicallyActivated;
+    if (type == "pressure-dependent-Arrhenius") return Type::PressureDependentArrhenius;
+    return Type::Other;
+}
+
+const std::string& CompactReactions::typeToString(Type type) {
+    return kTypeNames[static_cast<size_t>(type)];
+}
+
+CompactReactions::CompactReactions(const std::vector<ChemistryVars::ReactionData>& reactions) {
+    reserve(reactions.size());
+    for (const auto& reaction : reactions) {
+        push_back(reaction);
+    }
+}
+
+void CompactReactions::reserve(size_t n) {
+    m_records.reserve(n);
+    m_text.reserve(n * 24);
+}
+
+uint32_t CompactReactions::internName(const std::string& name) {
+    auto it = m_nameIndex.find(name);
+    if (it != m_nameIndex.end()) return it->second;
+    uint32_t id = static_cast<uint32_t>(m_names.size());
+    m_names.push_back(name);
+    m_nameIndex.emplace(name, id);
+    return id;
+}
+
+uint8_t CompactReactions::internUnit(const std::string& unit) {
+    for (size_t u = 0; u < m_units.size(); ++u) {
+        if (m_units[u] == unit) return static_cast<uint8_t>(u);
+    }
+    if (m_units.size() > 0xFF) {
+        throw std::length_error("CompactReactions: too many distinct unit strings");
+    }
+    m_units.push_back(unit);
+    return static_cast<uint8_t>(m_units.size() - 1);
+}
+
+void CompactReactions::appendCoefficients(const std::map<std::string, double>& values, uint32_t range[2]) {
+    range[0] = static_cast<uint32_t>(m_coefficients.size());
+    for (const auto& entry : values) {
+        m_coefficients.push_back({ internName(entry.first), entry.second });
+    }
+    range[1] = static_cast<uint32_t>(m_coefficients.size());
+}
+
+void CompactReactions::push_back(const ChemistryVars::ReactionData& reaction) {
+    const auto& rc = reaction.rateConstant;
+
+    Record record;
+    record.rate = { rc.A, rc.b, rc.Ea };
+    record.equation = static_cast<uint32_t>(m_text.size());
+    m_text.insert(m_text.end(), reaction.equation.begin(), reaction.equation.end());
+    m_text.push_back('\0');
+    record.type = typeFromString(reaction.type);
+    record.flags = reaction.isDuplicate ? Duplicate : 0;
+    if (reaction.type == kElementary) record.flags |= ExplicitType;
+    record.AUnits = internUnit(rc.A_units);
+    record.EaUnits = internUnit(rc.Ea_units);
+    record.extra = npos;
+
+    const auto& low = reaction.lowPressure;
+    const auto& troe = reaction.troe;
+    bool hasFalloff = low.A != 0.0 || low.b != 0.0 || low.Ea != 0.0 ||
+        troe.a != 0.0 || troe.T_star != 0.0 || troe.T_double_star != 0.0 || troe.T_triple_star != 0.0;
+    bool hasOther = record.type == Type::Other;
+
+    if (hasFalloff || hasOther || !reaction.efficiencies.empty() || !reaction.orders.empty() ||
+        !rc.plogData.empty()) {
+        Extra ex;
+        ex.falloff = npos;
+        ex.typeName = hasOther ? internName(reaction.type) : npos;
+        if (hasFalloff) {
+            ex.falloff = static_cast<uint32_t>(m_falloff.size());
+            m_falloff.push_back({ { low.A, low.b, low.Ea },
+                { troe.a, troe.T_star, troe.T_double_star, troe.T_triple_star } });
+            record.flags |= HasFalloff;
+        }
+        appendCoefficients(reaction.efficiencies, ex.efficiencies);
+        appendCoefficients(reaction.orders, ex.orders);
+        if (!reaction.efficiencies.empty()) record.flags |= HasEfficiencies;
+        if (!reaction.orders.empty()) record.flags |= HasOrders;
+
+        ex.plog[0] = static_cast<uint32_t>(m_plog.size());
+        for (const auto& p : rc.plogData) {
+            m_plog.push_back({ p.pressure, { p.A, p.b, p.Ea } });
+        }
+        ex.plog[1] = static_cast<uint32_t>(m_plog.size());
+        if (!rc.plogData.empty()) record.flags |= HasPlog;
+
+        record.extra = static_cast<uint32_t>(m_extras.size());
+        m_extras.push_back(ex);
+    }
+
+    m_records.push_back(record);
+}
+
+const CompactReactions::Extra* CompactReactions::extra(size_t i) const {
+    uint32_t e = m_records[i].extra;
+    return e != npos ? &m_extras[e] : nullptr;
+}
+
+const std::string& CompactReactions::typeName(size_t i) const {
+    const Extra* ex = extra(i);
+    if (ex && ex->typeName != npos) return m_names[ex->typeName];
+    if (m_records[i].flags & ExplicitType) return kElementary;
+    return typeToString(m_records[i].type);
+}
+
+const CompactReactions::FalloffBlock* CompactReactions::falloff(size_t i) const {
+    const Extra* ex = extra(i);
+    return ex && ex->falloff != npos ? &m_falloff[ex->falloff] : nullptr;
+}
+
+const CompactReactions::PlogPoint* CompactReactions::plogBegin(size_t i) const {
+    const Extra* ex = extra(i);
+    return m_plog.data() + (ex ? ex->plog[0] : 0);
+}
+
+const CompactReactions::PlogPoint* CompactReactions::plogEnd(size_t i) const {
+    const Extra* ex = extra(i);
+    return m_plog.data() + (ex ? ex->plog[1] : 0);
+}
+
+const CompactReactions::Coefficient* CompactReactions::efficienciesBegin(size_t i) const {
+    const Extra* ex = extra(i);
+    return m_coefficients.data() + (ex ? ex->efficiencies[0] : 0);
+}
+
+const CompactReactions::Coefficient* CompactReactions::efficienciesEnd(size_t i) const {
+    const Extra* ex = extra(i);
+    return m_coefficients.data() + (ex ? ex->efficiencies[1] : 0);
+}
+
+const CompactReactions::Coefficient* CompactReactions::ordersBegin(size_t i) const {
+    const Extra* ex = extra(i);
+    return m_coefficients.data() + (ex ? ex->orders[0] : 0);
+}
+
+const CompactReactions::Coefficient* CompactReactions::ordersEnd(size_t i) const {
+    const Extra* ex = extra(i);
+    return m_coefficients.data() + (ex ? ex->orders[1] : 0);
+}
+
+ChemistryVars::ReactionData CompactReactions::expand(size_t i) const {
+    const Record& record = m_records[i];
+    ChemistryVars::ReactionData reaction;
+    reaction.equation = equation(i);
+    reaction.type = typeName(i);
+    reaction.isDuplicate = (record.flags & Duplicate) != 0;
+
+    auto& rc = reaction.rateConstant;
+    rc.A = record.rate.A;
+    rc.b = record.rate.b;
+    rc.Ea = record.rate.Ea;
+    rc.A_units = m_units[record.AUnits];
+    rc.Ea_units = m_units[record.EaUnits];
+
+    const FalloffBlock* fo = falloff(i);
+    if (fo) {
+        reaction.lowPressure.A = fo->low.A;
+        reaction.lowPressure.b = fo->low.b;
+        reaction.lowPressure.Ea = fo->low.Ea;
+        reaction.troe.a = fo->troe[0];
+        reaction.troe.T_star = fo->troe[1];
+        reaction.troe.T_double_star = fo->troe[2];
+        reaction.troe.T_triple_star = fo->troe[3];
+    }
+
+    for (const Coefficient* c = efficienciesBegin(i); c != efficienciesEnd(i); ++c) {
+        reaction.efficiencies[m_names[c->name]] = c->value;
+    }
+    for (const Coefficient* c = ordersBegin(i); c != ordersEnd(i); ++c) {
+        reaction.orders[m_names[c->name]] = c->value;
+    }
+    for (const PlogPoint* p = plogBegin(i); p != plogEnd(i); ++p) {
+        rc.plogData.push_back({ p->pressure, p->rate.A, p->rate.b, p->rate.Ea });
+    }
+    rc.isPressureDependent = !rc.plogData.empty();
+    return reaction;
+}
+
+std::vector<ChemistryVars::ReactionData> CompactReactions::expandAll() const {
+    std::vector<ChemistryVars::ReactionData> reactions;
+    reactions.reserve(size());
+    for (size_t i = 0; i < size(); ++i) {
+        reactions.push_back(expand(i));
+    }
+    return reactions;
+}
+
+size_t CompactReactions::memoryUsage() const {
+    size_t bytes = sizeof(*this) +
+        m_records.capacity() * sizeof(Record) +
+        m_extras.capacity() * sizeof(Extra) +
+        m_falloff.capacity() * sizeof(FalloffBlock) +
+        m_plog.capacity() * sizeof(PlogPoint) +
+        m_coefficients.capacity() * sizeof(Coefficient) +
+        m_text.capacity() +
+        m_names.capacity() * sizeof(std::string) +
+        m_units.capacity() * sizeof(std::string);
+    for (const auto& name : m_names) bytes += heapBytes(name);
+    for (const auto& unit : m_units) bytes += heapBytes(unit);
+    // 哈希表: 每个节点一个指针 + 键值对, 外加桶数组
+    bytes += m_nameIndex.size() * (sizeof(void*) + sizeof(std::pair<const std::string, uint32_t>)) +
+        m_nameIndex.bucket_count() * sizeof(void*);
+    return bytes;
+}
+
+size_t CompactReactions::memoryUsage(const std::vector<ChemistryVars::ReactionData>& reactions) {
+    size_t bytes = sizeof(reactions) + reactions.capacity() * sizeof(ChemistryVars::ReactionData);
+    for (const auto& r : reactions) {
+        bytes += heapBytes(r.equation) + heapBytes(r.type) +
+            heapBytes(r.rateConstant.A_units) + heapBytes(r.rateConstant.Ea_units) +
+            heapBytes(r.efficiencies) + heapBytes(r.orders) +
+            r.rateConstant.plogData.capacity() * sizeof(ChemistryVars::ReactionData::PLOGPoint);
+    }
+    return bytes;
+}
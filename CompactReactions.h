@@ -0,0 +1,137 @@
+#pragma once
+#include "ChemistryVars.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// 紧凑的反应存储 - 用于大型机理 (数万个反应) 的只读持有
+// 每个反应只有一个定长记录: 枚举类型、驻留的单位编号、主速率参数;
+// 低压/Troe、第三体效率、反应级数和PLOG数据只在存在时存放在独立的连续数组中
+// 所有字符串(方程式、组分名、单位)只保存一份
+class CompactReactions {
+public:
+    enum class Type : uint8_t {
+        Elementary,                 // 未指定类型或 "elementary" (由ExplicitType标记区分)
+        ThreeBody,
+        Falloff,
+        ChemicallyActivated,
+        PressureDependentArrhenius, // PLOG
+        Other                       // 其他类型, 原始名称保存在附加块中
+    };
+
+    enum Flags : uint8_t {
+        Duplicate = 1,
+        HasFalloff = 2,
+        HasEfficiencies = 4,
+        HasOrders = 8,
+        HasPlog = 16,
+        ExplicitType = 32           // Elementary反应在输入中写明了 "elementary"
+    };
+
+    struct Arrhenius {
+        double A;
+        double b;
+        double Ea;
+    };
+
+    // 低压极限和Troe参数
+    struct FalloffBlock {
+        Arrhenius low;
+        double troe[4];             // a, T***(T3), T*(T1), T**(T2), 与ReactionData::troe顺序相同
+    };
+
+    struct PlogPoint {
+        double pressure;            // atm
+        Arrhenius rate;
+    };
+
+    // 组分名编号 + 数值 (第三体效率、反应级数)
+    struct Coefficient {
+        uint32_t name;
+        double value;
+    };
+
+    static const uint32_t npos = 0xFFFFFFFFu;
+
+    CompactReactions() = default;
+    explicit CompactReactions(const std::vector<ChemistryVars::ReactionData>& reactions);
+
+    void reserve(size_t n);
+    void push_back(const ChemistryVars::ReactionData& reaction);
+
+    size_t size() const { return m_records.size(); }
+    bool empty() const { return m_records.empty(); }
+
+    // 记录访问
+    Type type(size_t i) const { return m_records[i].type; }
+    bool hasFlag(size_t i, Flags flag) const { return (m_records[i].flags & flag) != 0; }
+    bool isDuplicate(size_t i) const { return hasFlag(i, Duplicate); }
+    const char* equation(size_t i) const { return m_text.data() + m_records[i].equation; }
+    const Arrhenius& rate(size_t i) const { return m_records[i].rate; }
+    const std::string& AUnits(size_t i) const { return m_units[m_records[i].AUnits]; }
+    const std::string& EaUnits(size_t i) const { return m_units[m_records[i].EaUnits]; }
+    // 类型名称 (与ReactionData::type相同, 未指定类型为空串, 写明的 "elementary" 原样返回)
+    const std::string& typeName(size_t i) const;
+
+    // 附加块 (不存在时返回nullptr或空区间)
+    const FalloffBlock* falloff(size_t i) const;
+    const PlogPoint* plogBegin(size_t i) const;
+    const PlogPoint* plogEnd(size_t i) const;
+    const Coefficient* efficienciesBegin(size_t i) const;
+    const Coefficient* efficienciesEnd(size_t i) const;
+    const Coefficient* ordersBegin(size_t i) const;
+    const Coefficient* ordersEnd(size_t i) const;
+
+    // 驻留的组分名
+    const std::string& name(uint32_t id) const { return m_names[id]; }
+
+    // 还原为完整的ReactionData
+    ChemistryVars::ReactionData expand(size_t i) const;
+    std::vector<ChemistryVars::ReactionData> expandAll() const;
+
+    // 当前占用的字节数 (含所有附加数组和字符串)
+    size_t memoryUsage() const;
+    // 同一组反应以 std::vector<ReactionData> 保存时的估计字节数
+    static size_t memoryUsage(const std::vector<ChemistryVars::ReactionData>& reactions);
+
+    static Type typeFromString(const std::string& type);
+    static const std::string& typeToString(Type type);
+
+private:
+    // 定长记录 (40字节)
+    struct Record {
+        Arrhenius rate;
+        uint32_t equation;          // m_text 中的偏移
+        uint32_t extra;             // m_extras 索引, 无附加数据为npos
+        Type type;
+        uint8_t flags;
+        uint8_t AUnits;             // m_units 索引
+        uint8_t EaUnits;
+    };
+
+    // 附加块索引 (只有约一半的反应需要)
+    struct Extra {
+        uint32_t falloff;           // m_falloff 索引或npos
+        uint32_t typeName;          // Type::Other 时的原始类型名 (m_names 索引)
+        uint32_t efficiencies[2];   // m_coefficients 区间
+        uint32_t orders[2];
+        uint32_t plog[2];           // m_plog 区间
+    };
+
+    uint32_t internName(const std::string& name);
+    uint8_t internUnit(const std::string& unit);
+    const Extra* extra(size_t i) const;
+    void appendCoefficients(const std::map<std::string, double>& values, uint32_t range[2]);
+
+    std::vector<Record> m_records;
+    std::vector<Extra> m_extras;
+    std::vector<FalloffBlock> m_falloff;
+    std::vector<PlogPoint> m_plog;              // 唯一的PLOG存储
+    std::vector<Coefficient> m_coefficients;
+    std::vector<char> m_text;                   // 以'\0'分隔的方程式
+
+    std::vector<std::string> m_names;
+    std::unordered_map<std::string, uint32_t> m_nameIndex;
+    std::vector<std::string> m_units;
+};
@@ -0,0 +1,229 @@
+#include "DRGReduction.h"
+#include "ReactionIndex.h"
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+DRGReduction::DRGReduction(std::shared_ptr<const ChemistryVars::MechanismData> mechanismPtr)
+    : m_source(std::make_shared<const MechanismView::Source>(std::move(mechanismPtr))),
+      m_nSpecies(m_source->nSpecies()),
+      m_nReactions(m_source->nReactions()) {
+    const MechanismView::Source& src = *m_source;
+    const ChemistryVars::MechanismData& mechanism = src.mechanism();
+
+    // 每个反应: 净化学计量系数 nu_A = 产物 - 反应物 (两侧都出现的组分可能为0)
+    std::vector<std::vector<std::pair<size_t, double>>> netNu(m_nReactions);
+    std::vector<std::pair<size_t, size_t>> pairs;
+    for (size_t i = 0; i < m_nReactions; ++i) {
+        ReactionIndex::Stoichiometry st = ReactionIndex::parseEquation(mechanism.reactions[i].equation);
+        auto& nu = netNu[i];
+        auto add = [&](const std::string& name, double coeff) {
+            size_t k = src.speciesIndex(name);
+            if (k == std::string::npos) return;
+            for (auto& entry : nu) {
+                if (entry.first == k) {
+                    entry.second += coeff;
+                    return;
+                }
+            }
+            nu.push_back(std::make_pair(k, coeff));
+        };
+        for (const auto& sp : st.reactants) add(sp.first, -sp.second);
+        for (const auto& sp : st.products) add(sp.first, sp.second);
+
+        // 边 A->B: A的净生成率受反应i影响, B参与反应i (含指定碰撞体)
+        for (const auto& entry : nu) {
+            if (entry.second == 0.0) continue;
+            for (const size_t* p = src.reactionSpeciesBegin(i); p != src.reactionSpeciesEnd(i); ++p) {
+                if (*p != std::string::npos && *p != entry.first) {
+                    pairs.push_back(std::make_pair(entry.first, *p));
+                }
+            }
+        }
+    }
+
+    std::sort(pairs.begin(), pairs.end());
+    pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+
+    m_edgeStart.assign(m_nSpecies + 1, 0);
+    m_edgeTarget.reserve(pairs.size());
+    for (const auto& p : pairs) {
+        m_edgeStart[p.first + 1]++;
+        m_edgeTarget.push_back(p.second);
+    }
+    for (size_t k = 0; k < m_nSpecies; ++k) {
+        m_edgeStart[k + 1] += m_edgeStart[k];
+    }
+
+    // 贡献项: 每个 (反应, A) 对应一组边索引, 累加时无需查找
+    m_termStart.reserve(m_nReactions + 1);
+    m_termStart.push_back(0);
+    for (size_t i = 0; i < m_nReactions; ++i) {
+        for (const auto& entry : netNu[i]) {
+            if (entry.second == 0.0) continue;
+            size_t A = entry.first;
+            Term term;
+            term.species = A;
+            term.absNu = std::fabs(entry.second);
+            term.edgeBegin = m_termEdges.size();
+
+            const size_t* first = m_edgeTarget.data() + m_edgeStart[A];
+            const size_t* last = m_edgeTarget.data() + m_edgeStart[A + 1];
+            for (const size_t* p = src.reactionSpeciesBegin(i); p != src.reactionSpeciesEnd(i); ++p) {
+                if (*p == std::string::npos || *p == A) continue;
+                size_t edge = std::lower_bound(first, last, *p) - m_edgeTarget.data();
+                // 同一组分在方程式两侧出现时避免重复计数
+                if (std::find(m_termEdges.begin() + term.edgeBegin, m_termEdges.end(), edge) == m_termEdges.end()) {
+                    m_termEdges.push_back(edge);
+                }
+            }
+            term.edgeEnd = m_termEdges.size();
+            m_terms.push_back(term);
+        }
+        m_termStart.push_back(m_terms.size());
+    }
+}
+
+size_t DRGReduction::speciesIndex(const std::string& name) const {
+    size_t k = m_source->speciesIndex(name);
+    if (k == std::string::npos) {
+        throw std::invalid_argument("DRGReduction: unknown species '" + name + "'");
+    }
+    return k;
+}
+
+void DRGReduction::accumulate(const std::vector<std::vector<double>>& samples, size_t begin, size_t end,
+    std::vector<double>& rmax) const {
+    std::vector<double> den(m_nSpecies);
+    std::vector<double> num(m_edgeTarget.size());
+
+    for (size_t s = begin; s < end; ++s) {
+        const std::vector<double>& rop = samples[s];
+        std::fill(den.begin(), den.end(), 0.0);
+        std::fill(num.begin(), num.end(), 0.0);
+
+        for (size_t i = 0; i < m_nReactions; ++i) {
+            double w = std::fabs(rop[i]);
+            if (w == 0.0) continue;
+            for (size_t t = m_termStart[i]; t < m_termStart[i + 1]; ++t) {
+                const Term& term = m_terms[t];
+                double contribution = term.absNu * w;
+                den[term.species] += contribution;
+                for (size_t e = term.edgeBegin; e < term.edgeEnd; ++e) {
+                    num[m_termEdges[e]] += contribution;
+                }
+            }
+        }
+
+        for (size_t A = 0; A < m_nSpecies; ++A) {
+            if (den[A] <= 0.0) continue;
+            double inv = 1.0 / den[A];
+            for (size_t e = m_edgeStart[A]; e < m_edgeStart[A + 1]; ++e) {
+                rmax[e] = std::max(rmax[e], num[e] * inv);
+            }
+        }
+    }
+}
+
+std::vector<double> DRGReduction::interactionCoefficients(const std::vector<std::vector<double>>& samples,
+    size_t nThreads) const {
+    for (const auto& rop : samples) {
+        if (rop.size() != m_nReactions) {
+            throw std::invalid_argument("DRGReduction: sample size does not match number of reactions");
+        }
+    }
+
+    if (nThreads == 0) nThreads = std::max(1u, std::thread::hardware_concurrency());
+    nThreads = std::min(nThreads, std::max<size_t>(samples.size(), 1));
+
+    // 各线程处理一段连续的采样状态, 最后对逐线程的最大值再取最大
+    std::vector<std::vector<double>> partial(nThreads, std::vector<double>(m_edgeTarget.size(), 0.0));
+    size_t chunk = (samples.size() + nThreads - 1) / nThreads;
+    std::vector<std::thread> workers;
+    for (size_t t = 1; t < nThreads; ++t) {
+        size_t begin = std::min(samples.size(), t * chunk);
+        size_t end = std::min(samples.size(), begin + chunk);
+        workers.emplace_back([this, &samples, &partial, t, begin, end]() {
+            accumulate(samples, begin, end, partial[t]);
+        });
+    }
+    accumulate(samples, 0, std::min(samples.size(), chunk), partial[0]);
+    for (auto& worker : workers) worker.join();
+
+    std::vector<double>& rmax = partial[0];
+    for (size_t t = 1; t < nThreads; ++t) {
+        for (size_t e = 0; e < rmax.size(); ++e) {
+            rmax[e] = std::max(rmax[e], partial[t][e]);
+        }
+    }
+    return std::move(rmax);
+}
+
+double DRGReduction::coefficient(const std::vector<double>& coefficients, size_t A, size_t B) const {
+    const size_t* first = m_edgeTarget.data() + m_edgeStart[A];
+    const size_t* last = m_edgeTarget.data() + m_edgeStart[A + 1];
+    const size_t* p = std::lower_bound(first, last, B);
+    return (p != last && *p == B) ? coefficients[p - m_edgeTarget.data()] : 0.0;
+}
+
+std::vector<bool> DRGReduction::retainedMask(const std::vector<double>& coefficients, const Options& options) const {
+    if (coefficients.size() != m_edgeTarget.size()) {
+        throw std::invalid_argument("DRGReduction: coefficient array size mismatch");
+    }
+
+    std::vector<bool> keep(m_nSpecies, false);
+    std::deque<size_t> queue;
+    for (const auto& name : options.targets) {
+        size_t k = speciesIndex(name);
+        if (!keep[k]) {
+            keep[k] = true;
+            queue.push_back(k);
+        }
+    }
+
+    // 广度优先搜索: r_AB 超过阈值的边视为A依赖B
+    while (!queue.empty()) {
+        size_t A = queue.front();
+        queue.pop_front();
+        for (size_t e = m_edgeStart[A]; e < m_edgeStart[A + 1]; ++e) {
+            size_t B = m_edgeTarget[e];
+            if (!keep[B] && coefficients[e] > options.threshold) {
+                keep[B] = true;
+                queue.push_back(B);
+            }
+        }
+    }
+
+    for (const auto& name : options.retainedSpecies) {
+        keep[speciesIndex(name)] = true;
+    }
+    return keep;
+}
+
+DRGReduction::Result DRGReduction::reduce(const std::vector<std::vector<double>>& samples,
+    const Options& options) const {
+    if (options.targets.empty()) {
+        throw std::invalid_argument("DRGReduction: no target species");
+    }
+
+    std::vector<double> coefficients = interactionCoefficients(samples, options.nThreads);
+    std::vector<bool> keep = retainedMask(coefficients, options);
+
+    Result result;
+    const auto& species = m_source->mechanism().thermoSpecies;
+    for (size_t k = 0; k < m_nSpecies; ++k) {
+        (keep[k] ? result.retainedSpecies : result.removedSpecies).push_back(species[k].name);
+    }
+    result.mechanism = MechanismView::fromMask(m_source, keep).materialize();
+    return result;
+}
+
+DRGReduction::Result DRGReduction::reduceToYaml(const std::vector<std::vector<double>>& samples,
+    const Options& options, const std::string& yamlFile) const {
+    Result result = reduce(samples, options);
+    ChemistryVars::writeMechanism(result.mechanism, yamlFile);
+    return result;
+}
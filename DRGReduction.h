@@ -0,0 +1,79 @@
+#pragma once
+#include "ChemistryVars.h"
+#include "MechanismView.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+// 直接关系图(DRG)机理简化
+// 组分相互作用系数 r_AB = sum_i |nu_A,i * w_i * delta_B,i| / sum_i |nu_A,i * w_i|
+// 对所有采样状态取最大值, 再从目标组分出发按阈值做广度优先搜索
+//
+// 库中尚无动力学求解器, 因此采样状态直接给出各反应的净反应进度 w_i (由调用方的求解器提供)
+class DRGReduction {
+public:
+    // 简化选项
+    struct Options {
+        double threshold = 0.1;                     // 相互作用系数阈值
+        std::vector<std::string> targets;           // 目标组分 (如燃料、氧化剂、重要产物)
+        std::vector<std::string> retainedSpecies;   // 始终保留的组分 (如惰性N2、AR)
+        size_t nThreads = 0;                        // 0 表示使用 hardware_concurrency
+    };
+
+    // 简化结果
+    struct Result {
+        ChemistryVars::MechanismData mechanism;     // 简化后的机理
+        std::vector<std::string> retainedSpecies;
+        std::vector<std::string> removedSpecies;
+    };
+
+    // 预处理组分-组分关系图 (与调用者共享父机理, 不复制); 为空时抛出 std::invalid_argument
+    explicit DRGReduction(std::shared_ptr<const ChemistryVars::MechanismData> mechanism);
+
+    size_t nSpecies() const { return m_nSpecies; }
+    size_t nReactions() const { return m_nReactions; }
+    // 有向边(A->B)数目
+    size_t nEdges() const { return m_edgeTarget.size(); }
+
+    // 计算所有采样状态下的最大相互作用系数 (按边存储, 多线程)
+    // samples[s][i] 为第s个状态下反应i的净反应进度
+    std::vector<double> interactionCoefficients(const std::vector<std::vector<double>>& samples,
+        size_t nThreads = 0) const;
+
+    // 给定相互作用系数, 按阈值从目标组分出发搜索保留组分 (掩码按父机理组分索引)
+    std::vector<bool> retainedMask(const std::vector<double>& coefficients, const Options& options) const;
+
+    // 相互作用系数 r_AB (A、B为组分索引, 无边时返回0)
+    double coefficient(const std::vector<double>& coefficients, size_t A, size_t B) const;
+
+    // 完整流程: 系数 -> 搜索 -> 简化机理
+    Result reduce(const std::vector<std::vector<double>>& samples, const Options& options) const;
+
+    // 简化并写出YAML文件
+    Result reduceToYaml(const std::vector<std::vector<double>>& samples, const Options& options,
+        const std::string& yamlFile) const;
+
+private:
+    // 反应i中组分A的贡献项: |nu_A,i| 以及受其影响的边 (A->B)
+    struct Term {
+        size_t species;
+        double absNu;
+        size_t edgeBegin;
+        size_t edgeEnd;
+    };
+
+    size_t speciesIndex(const std::string& name) const;
+    void accumulate(const std::vector<std::vector<double>>& samples, size_t begin, size_t end,
+        std::vector<double>& rmax) const;
+
+    std::shared_ptr<const MechanismView::Source> m_source;
+    size_t m_nSpecies;
+    size_t m_nReactions;
+
+    std::vector<size_t> m_termStart;        // 反应 -> 贡献项 (CSR)
+    std::vector<Term> m_terms;
+    std::vector<size_t> m_termEdges;        // 贡献项 -> 边索引
+
+    std::vector<size_t> m_edgeStart;        // 组分A -> 出边 (CSR)
+    std::vector<size_t> m_edgeTarget;       // 边 -> 组分B
+};
@@ -0,0 +1,146 @@
+#include "ElementTable.h"
+#include <cctype>
+#include <stdexcept>
+
+namespace {
+
+struct ElementWeight {
+    const char* symbol;
+    double weight;
+};
+
+// IUPAC 标准原子量 (常规值); 无稳定同位素的元素取代表性同位素的质量数
+const ElementWeight kElementWeights[] = {
+    {"H", 1.008}, {"He", 4.002602}, {"Li", 6.94}, {"Be", 9.0121831},
+    {"B", 10.81}, {"C", 12.011}, {"N", 14.007}, {"O", 15.999},
+    {"F", 18.998403163}, {"Ne", 20.1797}, {"Na", 22.98976928}, {"Mg", 24.305},
+    {"Al", 26.9815385}, {"Si", 28.085}, {"P", 30.973761998}, {"S", 32.06},
+    {"Cl", 35.45}, {"Ar", 39.948}, {"K", 39.0983}, {"Ca", 40.078},
+    {"Sc", 44.955908}, {"Ti", 47.867}, {"V", 50.9415}, {"Cr", 51.9961},
+    {"Mn", 54.938044}, {"Fe", 55.845}, {"Co", 58.933194}, {"Ni", 58.6934},
+    {"Cu", 63.546}, {"Zn", 65.38}, {"Ga", 69.723}, {"Ge", 72.630},
+    {"As", 74.921595}, {"Se", 78.971}, {"Br", 79.904}, {"Kr", 83.798},
+    {"Rb", 85.4678}, {"Sr", 87.62}, {"Y", 88.90584}, {"Zr", 91.224},
+    {"Nb", 92.90637}, {"Mo", 95.95}, {"Tc", 97.0}, {"Ru", 101.07},
+    {"Rh", 102.90550}, {"Pd", 106.42}, {"Ag", 107.8682}, {"Cd", 112.414},
+    {"In", 114.818}, {"Sn", 118.710}, {"Sb", 121.760}, {"Te", 127.60},
+    {"I", 126.90447}, {"Xe", 131.293}, {"Cs", 132.90545196}, {"Ba", 137.327},
+    {"La", 138.90547}, {"Ce", 140.116}, {"Pr", 140.90766}, {"Nd", 144.242},
+    {"Pm", 145.0}, {"Sm", 150.36}, {"Eu", 151.964}, {"Gd", 157.25},
+    {"Tb", 158.92535}, {"Dy", 162.500}, {"Ho", 164.93033}, {"Er", 167.259},
+    {"Tm", 168.93422}, {"Yb", 173.045}, {"Lu", 174.9668}, {"Hf", 178.49},
+    {"Ta", 180.94788}, {"W", 183.84}, {"Re", 186.207}, {"Os", 190.23},
+    {"Ir", 192.217}, {"Pt", 195.084}, {"Au", 196.966569}, {"Hg", 200.592},
+    {"Tl", 204.38}, {"Pb", 207.2}, {"Bi", 208.98040}, {"Po", 209.0},
+    {"At", 210.0}, {"Rn", 222.0}, {"Fr", 223.0}, {"Ra", 226.0},
+    {"Ac", 227.0}, {"Th", 232.0377}, {"Pa", 231.03588}, {"U", 238.02891},
+    {"Np", 237.0}, {"Pu", 244.0}, {"Am", 243.0}, {"Cm", 247.0},
+    {"Bk", 247.0}, {"Cf", 251.0}, {"Es", 252.0}, {"Fm", 257.0},
+    {"Md", 258.0}, {"No", 259.0}, {"Lr", 262.0}, {"Rf", 267.0},
+    {"Db", 268.0}, {"Sg", 271.0}, {"Bh", 274.0}, {"Hs", 269.0},
+    {"Mt", 276.0}, {"Ds", 281.0}, {"Rg", 281.0}, {"Cn", 285.0},
+    {"Nh", 286.0}, {"Fl", 289.0}, {"Mc", 288.0}, {"Lv", 293.0},
+    {"Ts", 294.0}, {"Og", 294.0},
+    // 同位素与电子
+    {"D", 2.01410177812}, {"T", 3.0160492779}, {"Tr", 3.0160492779},
+    {"E", 5.48579909065e-4}
+};
+
+const std::unordered_map<std::string, double>& weightTable() {
+    static const std::unordered_map<std::string, double> table = []() {
+        std::unordered_map<std::string, double> t;
+        for (const auto& e : kElementWeights) t.emplace(e.symbol, e.weight);
+        return t;
+    }();
+    return table;
+}
+
+// "AR" -> "Ar", "e" -> "E"
+std::string normalizeSymbol(const std::string& symbol) {
+    std::string s = symbol;
+    for (size_t i = 0; i < s.size(); ++i) {
+        unsigned char c = static_cast<unsigned char>(s[i]);
+        s[i] = static_cast<char>(i == 0 ? std::toupper(c) : std::tolower(c));
+    }
+    return s;
+}
+
+const double* findWeight(const std::string& symbol) {
+    const auto& table = weightTable();
+    auto it = table.find(symbol);
+    if (it == table.end()) it = table.find(normalizeSymbol(symbol));
+    return it != table.end() ? &it->second : nullptr;
+}
+
+} // namespace
+
+double ElementTable::standardAtomicWeight(const std::string& symbol) {
+    const double* w = findWeight(symbol);
+    if (!w) throw std::invalid_argument("Unknown element '" + symbol + "'");
+    return *w;
+}
+
+bool ElementTable::isKnownElement(const std::string& symbol) {
+    return findWeight(symbol) != nullptr;
+}
+
+ElementTable::ElementTable(const std::vector<ChemistryVars::ThermoData>& species)
+    : m_nSpecies(species.size()) {
+    // 第一遍: 收集元素
+    for (const auto& sp : species) {
+        for (const auto& elem : sp.composition) {
+            if (m_index.count(elem.first)) continue;
+            const double* w = findWeight(elem.first);
+            if (!w) {
+                throw std::invalid_argument("Unknown element '" + elem.first + "' in species '" + sp.name + "'");
+            }
+            m_index.emplace(elem.first, m_names.size());
+            m_names.push_back(elem.first);
+            m_atomicWeights.push_back(*w);
+        }
+    }
+
+    // 第二遍: 填充组成矩阵
+    size_t nel = m_names.size();
+    m_composition.assign(m_nSpecies * nel, 0.0);
+    for (size_t k = 0; k < m_nSpecies; ++k) {
+        for (const auto& elem : species[k].composition) {
+            m_composition[k * nel + m_index.at(elem.first)] += elem.second;
+        }
+    }
+}
+
+size_t ElementTable::elementIndex(const std::string& name) const {
+    auto it = m_index.find(name);
+    return it != m_index.end() ? it->second : std::string::npos;
+}
+
+void ElementTable::getMolecularWeights(double* mw) const {
+    size_t nel = m_names.size();
+    const double* row = m_composition.data();
+    for (size_t k = 0; k < m_nSpecies; ++k, row += nel) {
+        double sum = 0.0;
+        for (size_t m = 0; m < nel; ++m) {
+            sum += row[m] * m_atomicWeights[m];
+        }
+        mw[k] = sum;
+    }
+}
+
+std::vector<double> ElementTable::molecularWeights() const {
+    std::vector<double> mw(m_nSpecies);
+    getMolecularWeights(mw.data());
+    return mw;
+}
+
+void ElementTable::getElementMoles(const double* moles, double* b) const {
+    size_t nel = m_names.size();
+    for (size_t m = 0; m < nel; ++m) b[m] = 0.0;
+    const double* row = m_composition.data();
+    for (size_t k = 0; k < m_nSpecies; ++k, row += nel) {
+        if (moles[k] == 0.0) continue;
+        for (size_t m = 0; m < nel; ++m) {
+            b[m] += row[m] * moles[k];
+        }
+    }
+}
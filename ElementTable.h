@@ -0,0 +1,52 @@
+#pragma once
+#include "ChemistryVars.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// 元素表 - 机理中出现的元素及其原子量, 以及稠密的 组分×元素 组成矩阵
+// 每个机理只建立一次; 分子量 = 组成矩阵 × 原子量向量
+// 组成矩阵同时用于元素守恒检查和化学平衡计算
+class ElementTable {
+public:
+    ElementTable() = default;
+
+    // 由组分热力学数据建立 (元素按首次出现的顺序编号)
+    // 含有未知元素的组分抛出 std::invalid_argument, 不会被静默地当作原子量0
+    explicit ElementTable(const std::vector<ChemistryVars::ThermoData>& species);
+
+    // 标准原子量 kg/kmol (完整元素周期表, 另有同位素D、T及电子E)
+    // 大小写不敏感 ("AR" 与 "Ar" 相同), 未知元素抛出 std::invalid_argument
+    static double standardAtomicWeight(const std::string& symbol);
+    static bool isKnownElement(const std::string& symbol);
+
+    size_t nElements() const { return m_names.size(); }
+    size_t nSpecies() const { return m_nSpecies; }
+
+    const std::vector<std::string>& elementNames() const { return m_names; }
+    const std::string& elementName(size_t m) const { return m_names[m]; }
+    // 元素名 -> 索引 (未找到返回npos)
+    size_t elementIndex(const std::string& name) const;
+
+    const std::vector<double>& atomicWeights() const { return m_atomicWeights; }
+    double atomicWeight(size_t m) const { return m_atomicWeights[m]; }
+
+    // 组分k中元素m的原子数
+    double nAtoms(size_t k, size_t m) const { return m_composition[k * m_names.size() + m]; }
+    // 行主序组成矩阵 (nSpecies × nElements)
+    const std::vector<double>& compositionMatrix() const { return m_composition; }
+
+    // 分子量 kg/kmol (矩阵-向量乘积), mw长度为nSpecies
+    void getMolecularWeights(double* mw) const;
+    std::vector<double> molecularWeights() const;
+
+    // 各元素的物质的量 b_m = sum_k n_km * moles_k, b长度为nElements
+    void getElementMoles(const double* moles, double* b) const;
+
+private:
+    std::vector<std::string> m_names;
+    std::vector<double> m_atomicWeights;
+    std::unordered_map<std::string, size_t> m_index;
+    std::vector<double> m_composition;
+    size_t m_nSpecies = 0;
+};
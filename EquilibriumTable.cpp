@@ -0,0 +1,168 @@
+#include "EquilibriumTable.h"
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+// 每个线程待计算的线 [next, end); 自己从前端取, 被窃取时从后端取走一半
+struct EquilibriumTable::Queue {
+    std::mutex mutex;
+    size_t next = 0;
+    size_t end = 0;
+
+    bool pop(size_t& line) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (next >= end) return false;
+        line = next++;
+        return true;
+    }
+    size_t remaining() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return end - std::min(next, end);
+    }
+    // 取走后一半 (至少一条), 没有剩余时返回false
+    bool steal(size_t& begin, size_t& stop) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (next >= end) return false;
+        size_t half = (end - next + 1) / 2;
+        begin = end - half;
+        stop = end;
+        end = begin;
+        return true;
+    }
+    void assign(size_t begin, size_t stop) {
+        std::lock_guard<std::mutex> lock(mutex);
+        next = begin;
+        end = stop;
+    }
+};
+
+EquilibriumTable::EquilibriumTable(const IdealGasPhase& gas, const std::string& fuel, double Tfuel,
+    const std::string& oxidizer, double Toxidizer)
+    : m_gas(gas) {
+    // 两股流的质量分数和焓 (理想气体的焓与压力无关)
+    size_t nsp = m_gas.nSpecies();
+    m_Yfuel.resize(nsp);
+    m_Yoxidizer.resize(nsp);
+    m_gas.setState_TPX(Tfuel, OneAtm, fuel);
+    m_gas.getMassFractions(m_Yfuel.data());
+    m_hFuel = m_gas.enthalpy_mass();
+    m_gas.setState_TPX(Toxidizer, OneAtm, oxidizer);
+    m_gas.getMassFractions(m_Yoxidizer.data());
+    m_hOxidizer = m_gas.enthalpy_mass();
+}
+
+EquilibriumTable::Stats EquilibriumTable::compute(const Grid& grid, const Output& out, size_t nThreads) const {
+    if (grid.nPoints() == 0) {
+        throw std::invalid_argument("EquilibriumTable: empty grid");
+    }
+    size_t nLines = grid.enthalpyDefect.size() * grid.P.size();
+    if (nThreads == 0) nThreads = std::max(1u, std::thread::hardware_concurrency());
+    nThreads = std::max<size_t>(1, std::min(nThreads, nLines));
+
+    // 先按连续的段分配, 相邻的线大多由同一线程依次计算
+    std::vector<std::unique_ptr<Queue>> queues;
+    size_t chunk = (nLines + nThreads - 1) / nThreads;
+    for (size_t t = 0; t < nThreads; ++t) {
+        queues.emplace_back(new Queue());
+        queues[t]->assign(std::min(nLines, t * chunk), std::min(nLines, (t + 1) * chunk));
+    }
+
+    std::vector<Stats> partial(nThreads);
+    auto work = [this, &grid, &out, &queues, &partial](size_t t) {
+        IdealGasPhase gas = m_gas;
+        GasEquilibrium solver(m_options);
+        std::vector<double> Y(nSpecies());
+        Stats& stats = partial[t];
+        for (;;) {
+            size_t line;
+            if (queues[t]->pop(line)) {
+                computeLine(grid, out, line, gas, solver, Y, stats);
+                continue;
+            }
+            // 自己的线做完后从剩余最多的线程窃取
+            size_t victim = t;
+            size_t most = 0;
+            for (size_t v = 0; v < queues.size(); ++v) {
+                size_t r = v == t ? 0 : queues[v]->remaining();
+                if (r > most) {
+                    most = r;
+                    victim = v;
+                }
+            }
+            size_t begin, stop;
+            if (most == 0) break;
+            if (queues[victim]->steal(begin, stop)) {
+                queues[t]->assign(begin, stop);
+                ++stats.nSteals;
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t t = 1; t < nThreads; ++t) workers.emplace_back(work, t);
+    work(0);
+    for (auto& worker : workers) worker.join();
+
+    Stats stats;
+    for (const Stats& p : partial) {
+        stats.nPoints += p.nPoints;
+        stats.nFailed += p.nFailed;
+        stats.totalIterations += p.totalIterations;
+        stats.totalTemperatureIterations += p.totalTemperatureIterations;
+        stats.nSteals += p.nSteals;
+    }
+    return stats;
+}
+
+void EquilibriumTable::computeLine(const Grid& grid, const Output& out, size_t line, IdealGasPhase& gas,
+    GasEquilibrium& solver, std::vector<double>& Y, Stats& stats) const {
+    size_t nZ = grid.Z.size();
+    size_t nH = grid.enthalpyDefect.size();
+    size_t nsp = nSpecies();
+    // 线的顺序在焓亏损方向上也是蛇形的, 换到下一个压力时仍与上一条线相邻
+    size_t iP = line / nH;
+    size_t iH = iP % 2 == 0 ? line % nH : nH - 1 - line % nH;
+    double P = grid.P[iP];
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+
+    for (size_t j = 0; j < nZ; ++j) {
+        // 蛇形扫描: 偶数线Z递增, 奇数线Z递减
+        size_t iZ = line % 2 == 0 ? j : nZ - 1 - j;
+        double Z = grid.Z[iZ];
+        for (size_t k = 0; k < nsp; ++k) Y[k] = Z * m_Yfuel[k] + (1.0 - Z) * m_Yoxidizer[k];
+        double h = mixtureEnthalpy(Z) + grid.enthalpyDefect[iH];
+        size_t i = grid.index(iZ, iH, iP);
+
+        // 温度只是没有初值时的起点, 热启动时用上一个点的平衡温度
+        // 压力直接按Pa设定, 不经过setPressure (其中把小于1e4的值当作atm)
+        gas.setTemperature(solver.hasSolution() ? solver.temperature() : 300.0);
+        gas.setMassFractions(Y.data());
+        gas.setPressurePa(P);
+        bool converged = true;
+        try {
+            solver.equilibrate(gas, GasEquilibrium::Constraint::HP, h);
+        }
+        catch (const std::exception&) {
+            converged = false;
+        }
+        ++stats.nPoints;
+        stats.totalIterations += solver.iterations();
+        stats.totalTemperatureIterations += solver.temperatureIterations();
+        if (!converged) {
+            // 求解器只在收敛时保存解, 下一个点仍以最后一个收敛的点为初值
+            ++stats.nFailed;
+            if (out.T) out.T[i] = nan;
+            if (out.density) out.density[i] = nan;
+            if (out.meanMolecularWeight) out.meanMolecularWeight[i] = nan;
+            if (out.Y) std::fill(out.Y + i * nsp, out.Y + (i + 1) * nsp, nan);
+            continue;
+        }
+        if (out.T) out.T[i] = gas.temperature();
+        if (out.density) out.density[i] = gas.density();
+        if (out.meanMolecularWeight) out.meanMolecularWeight[i] = gas.meanMolecularWeight();
+        if (out.Y) gas.getMassFractions(out.Y + i * nsp);
+    }
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include "GasEquilibrium.h"
+#include <string>
+#include <vector>
+
+// 平衡查找表的批量计算 - (混合分数Z, 焓亏损, 压力) 网格上的HP平衡
+// 点 (iZ, iH, iP) 的组成为燃料与氧化剂按Z混合 (质量), 焓为两股流的绝热混合焓加焓亏损
+// 网格按 "线" 分配给线程: 一条线是固定 (iH, iP) 的全部Z; 线内相邻点互为热启动初值,
+// 线按 (iP, iH) 蛇形排列, 相邻的线按相反方向扫描, 使一条线的起点与上一条线的终点相邻
+// 每个线程先取连续的一段线, 做完后从剩余最多的线程取走其后一半 (工作窃取); 同一对象可以从多个线程同时调用
+class EquilibriumTable {
+public:
+    struct Grid {
+        std::vector<double> Z;                  // 混合分数 (燃料的质量分数) 0..1
+        std::vector<double> enthalpyDefect;     // 相对于绝热混合焓的焓亏损 J/kg (热损失为负)
+        std::vector<double> P;                  // Pa
+        size_t nPoints() const { return Z.size() * enthalpyDefect.size() * P.size(); }
+        // 点 (iZ, iH, iP) 在输出数组中的下标
+        size_t index(size_t iZ, size_t iH, size_t iP) const {
+            return (iP * enthalpyDefect.size() + iH) * Z.size() + iZ;
+        }
+    };
+
+    // 调用者提供的输出数组 (长度为网格点数, Y为点数×nSpecies), 为空的不写; 不收敛的点写入NaN
+    struct Output {
+        double* T = nullptr;                    // K
+        double* density = nullptr;              // kg/m³
+        double* meanMolecularWeight = nullptr;  // kg/kmol
+        double* Y = nullptr;                    // 平衡质量分数 Y[i*nSpecies + k]
+    };
+
+    struct Stats {
+        size_t nPoints = 0;
+        size_t nFailed = 0;                     // 不收敛或无解 (如焓低于Tmin下的平衡焓) 的点数
+        size_t totalIterations = 0;             // 固定温度Newton迭代次数之和
+        size_t totalTemperatureIterations = 0;
+        size_t nSteals = 0;                     // 工作窃取的次数
+        double meanIterations() const {
+            return nPoints > 0 ? static_cast<double>(totalIterations) / nPoints : 0.0;
+        }
+    };
+
+    // fuel, oxidizer: 摩尔分数 (如 "CH4:1", "O2:0.21, N2:0.79"), 温度 K
+    EquilibriumTable(const IdealGasPhase& gas, const std::string& fuel, double Tfuel,
+        const std::string& oxidizer, double Toxidizer);
+
+    size_t nSpecies() const { return m_Yfuel.size(); }
+    // 混合分数Z处的绝热混合焓 J/kg
+    double mixtureEnthalpy(double Z) const { return Z * m_hFuel + (1.0 - Z) * m_hOxidizer; }
+
+    // nThreads = 0 时使用 hardware_concurrency; 网格为空时抛出 std::invalid_argument
+    Stats compute(const Grid& grid, const Output& out, size_t nThreads = 0) const;
+
+    const GasEquilibrium::Options& options() const { return m_options; }
+    void setOptions(const GasEquilibrium::Options& options) { m_options = options; }
+
+private:
+    struct Queue;
+    // 计算一条线的全部点
+    void computeLine(const Grid& grid, const Output& out, size_t line, IdealGasPhase& gas,
+        GasEquilibrium& solver, std::vector<double>& Y, Stats& stats) const;
+
+    IdealGasPhase m_gas;                        // 各线程复制的模板 (共享组分数据库)
+    GasEquilibrium::Options m_options;
+    std::vector<double> m_Yfuel;
+    std::vector<double> m_Yoxidizer;
+    double m_hFuel = 0.0;
+    double m_hOxidizer = 0.0;
+};
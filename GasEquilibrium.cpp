@@ -0,0 +1,562 @@
+#include "GasEquilibrium.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+// 每次Newton迭代未知数的最大变化量 (对数单位)
+const double MaxStep = 20.0;
+// 线性方程组主元小于最大元的这个倍数时视为奇异方向
+const double RankTolerance = 1e-13;
+// 元素方程的和小于此值时按该行的最大项重新缩放, 避免下溢
+const double UnderflowSum = 1e-250;
+// HP/UV没有初值时从这个温度开始 (低于它时): 在燃烧产物的温度附近, Gordon-McBride迭代也比低温快
+const double ColdStartTemperature = 2000.0;
+
+// 完全主元Gauss消元解 A x = b (A为n×n行主序, A和b被覆盖)
+// 奇异方向 (痕量组分决定的元素势之差等) 的分量取0, 只求解确定的部分
+void solveDense(double* A, double* b, double* x, size_t n, std::vector<size_t>& cols) {
+    // 先按行最大元缩放 (痕量元素的守恒方程与主量元素同一量级)
+    cols.resize(n);
+    double maxAll = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        cols[i] = i;
+        double rowMax = 0.0;
+        for (size_t j = 0; j < n; ++j) rowMax = std::max(rowMax, std::abs(A[i * n + j]));
+        if (rowMax > 0.0) {
+            for (size_t j = 0; j < n; ++j) A[i * n + j] /= rowMax;
+            b[i] /= rowMax;
+            maxAll = 1.0;
+        }
+    }
+
+    size_t rank = n;
+    for (size_t i = 0; i < n; ++i) {
+        size_t p = i, q = i;
+        double pivot = 0.0;
+        for (size_t r = i; r < n; ++r) {
+            for (size_t c = i; c < n; ++c) {
+                if (std::abs(A[r * n + c]) > pivot) {
+                    pivot = std::abs(A[r * n + c]);
+                    p = r;
+                    q = c;
+                }
+            }
+        }
+        if (pivot <= RankTolerance * maxAll) {
+            rank = i;
+            break;
+        }
+        if (p != i) {
+            for (size_t c = 0; c < n; ++c) std::swap(A[i * n + c], A[p * n + c]);
+            std::swap(b[i], b[p]);
+        }
+        if (q != i) {
+            for (size_t r = 0; r < n; ++r) std::swap(A[r * n + i], A[r * n + q]);
+            std::swap(cols[i], cols[q]);
+        }
+        for (size_t r = i + 1; r < n; ++r) {
+            double f = A[r * n + i] / A[i * n + i];
+            if (f == 0.0) continue;
+            for (size_t c = i + 1; c < n; ++c) A[r * n + c] -= f * A[i * n + c];
+            b[r] -= f * b[i];
+        }
+    }
+
+    for (size_t i = n; i-- > 0;) {
+        double z = 0.0;
+        if (i < rank) {
+            z = b[i];
+            for (size_t c = i + 1; c < rank; ++c) z -= A[i * n + c] * b[c];
+            z /= A[i * n + i];
+        }
+        b[i] = z;
+    }
+    for (size_t i = 0; i < n; ++i) x[cols[i]] = b[i];
+}
+
+} // namespace
+
+GasEquilibrium::GasEquilibrium() {}
+
+GasEquilibrium::GasEquilibrium(const Options& options) : m_options(options) {}
+
+GasEquilibrium::Constraint GasEquilibrium::parseConstraint(const std::string& XY) {
+    std::string key = XY;
+    for (char& c : key) c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    if (key.size() == 2) {
+        std::sort(key.begin(), key.end());
+        if (key == "PT") return Constraint::TP;
+        if (key == "HP") return Constraint::HP;
+        if (key == "PS") return Constraint::SP;
+        if (key == "UV") return Constraint::UV;
+    }
+    throw std::invalid_argument("Unsupported equilibrium constraint '" + XY + "' (use TP, HP, SP or UV)");
+}
+
+void GasEquilibrium::setup(const IdealGasPhase& gas) {
+    const std::shared_ptr<const SpeciesThermo>& db = gas.speciesThermo();
+    if (!db || db->nSpecies() == 0) {
+        throw std::invalid_argument("Equilibrium: phase has no species");
+    }
+    if (gas.nSpecies() != db->nSpecies()) {
+        throw std::invalid_argument("Equilibrium: phase contains species without thermo data");
+    }
+    if (m_species != db) {
+        m_species = db;
+        m_hasSolution = false;
+    }
+    m_table = gas.thermoTable();
+    const ElementTable& elements = db->elements();
+    size_t nsp = db->nSpecies();
+    size_t nel = elements.nElements();
+    m_work.resize(nsp);
+
+    // 元素的物质的量 (每kg混合物), 不含的元素不参与计算
+    m_x.resize(nsp);
+    gas.getMassFractions(m_x.data());
+    const std::vector<double>& mw = db->molecularWeights();
+    for (size_t k = 0; k < nsp; ++k) m_x[k] /= mw[k];
+    m_b.resize(nel);
+    elements.getElementMoles(m_x.data(), m_b.data());
+
+    m_elem.clear();
+    for (size_t m = 0; m < nel; ++m) {
+        if (m_b[m] > 0.0) m_elem.push_back(m);
+    }
+    m_spec.clear();
+    for (size_t k = 0; k < nsp; ++k) {
+        bool active = true;
+        for (size_t m = 0; m < nel && active; ++m) {
+            double a = elements.nAtoms(k, m);
+            active = a == 0.0 || (a > 0.0 && m_b[m] > 0.0);
+        }
+        if (active) m_spec.push_back(k);
+    }
+    if (m_elem.empty() || m_spec.empty()) {
+        throw std::invalid_argument("Equilibrium: mixture contains no elements");
+    }
+
+    size_t M = m_elem.size();
+    size_t K = m_spec.size();
+    m_A.resize(K * M);
+    for (size_t i = 0; i < K; ++i) {
+        for (size_t j = 0; j < M; ++j) m_A[i * M + j] = elements.nAtoms(m_spec[i], m_elem[j]);
+    }
+    m_logB.resize(M);
+    for (size_t j = 0; j < M; ++j) m_logB[j] = std::log(m_b[m_elem[j]]);
+
+    m_mu0.resize(K);
+    m_lnn.resize(K);
+    m_e.resize(K);
+    m_w.resize(K);
+    m_dlnn.resize(K);
+    m_gln.resize(K);
+    m_rowScale.resize(M);
+    m_rowSum.resize(M);
+    if (m_potentials.size() != nel) {
+        m_potentials.assign(nel, 0.0);
+        m_hasSolution = false;
+    }
+}
+
+void GasEquilibrium::setTemperature(double T, double lnShift) {
+    m_species->update(T, m_work, m_table.get());
+    for (size_t i = 0; i < m_spec.size(); ++i) {
+        m_mu0[i] = m_work.g_RT[m_spec[i]] + lnShift;
+    }
+}
+
+bool GasEquilibrium::solvePrimal(double lnN) {
+    // Gordon-McBride (NASA CEA) 迭代: 以各组分的 ln n_k 为变量, 每步解同样的元素势线性方程组,
+    // 按主量组分一步最多变化e²倍、痕量组分一步不超过1e-4摩尔分数的规则阻尼 (主量组分的减小也受限制,
+    // 否则在外推的多项式下线性方程组可能奇异); 从各组分等量开始, 不需要初值
+    const double Size = 18.420681;              // 摩尔分数1e-8以下视为痕量组分
+    const double TraceLimit = 9.2103404;        // -ln(1e-4)
+    const double Tolerance = 1e-2;              // 主量组分的修正量都小于此值后交给Newton迭代
+    size_t M = m_elem.size();
+    size_t K = m_spec.size();
+    size_t nu = m_u.size();
+    for (size_t i = 0; i < K; ++i) m_gln[i] = lnN - std::log(static_cast<double>(K));
+
+    for (int it = 0; it < 2 * m_options.maxIterations; ++it) {
+        ++m_iterations;
+        double sumN = 0.0;
+        for (size_t i = 0; i < K; ++i) {
+            m_e[i] = std::exp(m_gln[i]);
+            sumN += m_e[i];
+        }
+        if (!m_fixedPressure) lnN = std::log(sumN);
+        double N = std::exp(lnN);
+        // μ_k/RT; 定容时μ0中已含 ln(RT/(v P0)), 没有 ln N 项
+        for (size_t i = 0; i < K; ++i) m_dlnn[i] = m_mu0[i] + m_gln[i] - (m_fixedPressure ? lnN : 0.0);
+
+        std::fill(m_jac.begin(), m_jac.end(), 0.0);
+        std::fill(m_rhs.begin(), m_rhs.end(), 0.0);
+        for (size_t m = 0; m < M; ++m) m_rhs[m] = m_b[m_elem[m]];
+        for (size_t i = 0; i < K; ++i) {
+            const double* a = &m_A[i * M];
+            double n = m_e[i];
+            for (size_t r = 0; r < M; ++r) {
+                if (a[r] == 0.0) continue;
+                double an = a[r] * n;
+                for (size_t c = 0; c < M; ++c) m_jac[r * nu + c] += an * a[c];
+                m_rhs[r] += an * (m_dlnn[i] - 1.0);
+                if (m_fixedPressure) m_jac[r * nu + M] += an;
+            }
+            if (m_fixedPressure) {
+                for (size_t c = 0; c < M; ++c) m_jac[M * nu + c] += a[c] * n;
+                m_rhs[M] += n * (m_dlnn[i] - 1.0);
+            }
+        }
+        if (m_fixedPressure) {
+            m_jac[M * nu + M] = sumN - N;
+            m_rhs[M] += N;
+        }
+        m_lu = m_jac;
+        solveDense(m_lu.data(), m_rhs.data(), m_step.data(), nu, m_cols);
+        double dlnN = m_fixedPressure ? m_step[M] : 0.0;
+
+        // 各组分的修正量, 收敛判断与阻尼
+        bool converged = std::abs(dlnN) <= Tolerance;
+        double lnSum = std::log(sumN);
+        double largest = 5.0 * std::abs(dlnN);
+        double lambda = 1.0;
+        for (size_t i = 0; i < K; ++i) {
+            const double* a = &m_A[i * M];
+            double d = dlnN - m_dlnn[i];
+            for (size_t j = 0; j < M; ++j) d += a[j] * m_step[j];
+            m_dlnn[i] = d;
+            double lnx = m_gln[i] - lnSum;
+            if (lnx > -Size) {
+                largest = std::max(largest, std::abs(d));
+                if (std::abs(d) > Tolerance) converged = false;
+            }
+            else if (d > dlnN) {
+                lambda = std::min(lambda, std::abs((-lnx - TraceLimit) / (d - dlnN)));
+            }
+        }
+        // 痕量组分按完整的一步会超过1e-4摩尔分数时, 元素势还不能描述平衡组成
+        if (converged && lambda == 1.0) {
+            if (m_fixedPressure) m_step[M] = lnN;
+            m_u.assign(m_step.begin(), m_step.begin() + nu);
+            return true;
+        }
+        if (largest > 2.0) lambda = std::min(lambda, 2.0 / largest);
+        for (size_t i = 0; i < K; ++i) m_gln[i] += lambda * m_dlnn[i];
+        if (m_fixedPressure) lnN += lambda * dlnN;
+    }
+    return false;
+}
+
+double GasEquilibrium::evaluate(const double* u, bool jacobian) {
+    size_t M = m_elem.size();
+    size_t K = m_spec.size();
+    size_t nu = m_u.size();
+    double y = m_fixedPressure ? u[M] : 0.0;
+
+    double L = -std::numeric_limits<double>::infinity();
+    for (size_t i = 0; i < K; ++i) {
+        const double* a = &m_A[i * M];
+        double l = y - m_mu0[i];
+        for (size_t j = 0; j < M; ++j) l += a[j] * u[j];
+        m_lnn[i] = l;
+        L = std::max(L, l);
+    }
+    double sumE = 0.0;
+    for (size_t i = 0; i < K; ++i) {
+        m_e[i] = std::exp(m_lnn[i] - L);
+        sumE += m_e[i];
+    }
+    m_scale = L;
+    m_sumE = sumE;
+
+    double maxRes = 0.0;
+    for (size_t m = 0; m < M; ++m) {
+        const double* wt = m_e.data();
+        double S = 0.0;
+        for (size_t i = 0; i < K; ++i) S += m_A[i * M + m] * wt[i];
+        double scale = L;
+        if (S < UnderflowSum) {
+            // 含该元素的组分相对于主量组分全部下溢: 按该行的最大项重新缩放
+            scale = -std::numeric_limits<double>::infinity();
+            for (size_t i = 0; i < K; ++i) {
+                if (m_A[i * M + m] > 0.0) scale = std::max(scale, m_lnn[i]);
+            }
+            S = 0.0;
+            for (size_t i = 0; i < K; ++i) {
+                m_w[i] = m_A[i * M + m] > 0.0 ? std::exp(m_lnn[i] - scale) : 0.0;
+                S += m_A[i * M + m] * m_w[i];
+            }
+            wt = m_w.data();
+        }
+        m_rowScale[m] = scale;
+        m_rowSum[m] = S;
+        m_res[m] = std::log(S) + scale - m_logB[m];
+        maxRes = std::max(maxRes, std::abs(m_res[m]));
+
+        if (jacobian) {
+            double* row = &m_jac[m * nu];
+            std::fill(row, row + nu, 0.0);
+            for (size_t i = 0; i < K; ++i) {
+                double f = m_A[i * M + m] * wt[i];
+                if (f == 0.0) continue;
+                const double* a = &m_A[i * M];
+                for (size_t j = 0; j < M; ++j) row[j] += f * a[j];
+            }
+            for (size_t j = 0; j < M; ++j) row[j] /= S;
+            if (m_fixedPressure) row[M] = 1.0;
+        }
+    }
+
+    if (m_fixedPressure) {
+        // 归一化: ln Σ n_k = ln N
+        m_res[M] = std::log(sumE) + L - y;
+        maxRes = std::max(maxRes, std::abs(m_res[M]));
+        if (jacobian) {
+            double* row = &m_jac[M * nu];
+            std::fill(row, row + nu, 0.0);
+            for (size_t i = 0; i < K; ++i) {
+                const double* a = &m_A[i * M];
+                for (size_t j = 0; j < M; ++j) row[j] += m_e[i] * a[j];
+            }
+            for (size_t j = 0; j < M; ++j) row[j] /= sumE;
+        }
+    }
+    return maxRes;
+}
+
+bool GasEquilibrium::solveFixedTemperature() {
+    size_t nu = m_u.size();
+    m_residual = evaluate(m_u.data(), true);
+    for (int it = 0; it < m_options.maxIterations; ++it) {
+        if (m_residual <= m_options.tolerance) return true;
+        ++m_iterations;
+
+        m_lu = m_jac;
+        for (size_t i = 0; i < nu; ++i) m_rhs[i] = -m_res[i];
+        solveDense(m_lu.data(), m_rhs.data(), m_step.data(), nu, m_cols);
+        double stepMax = 0.0;
+        for (size_t i = 0; i < nu; ++i) stepMax = std::max(stepMax, std::abs(m_step[i]));
+        if (stepMax > MaxStep) {
+            for (size_t i = 0; i < nu; ++i) m_step[i] *= MaxStep / stepMax;
+        }
+
+        // 以残差平方和为评价函数回溯
+        double merit = 0.0;
+        for (size_t i = 0; i < nu; ++i) merit += m_res[i] * m_res[i];
+        double alpha = 1.0;
+        bool accepted = false;
+        for (int ls = 0; ls < 30 && !accepted; ++ls) {
+            for (size_t i = 0; i < nu; ++i) m_trial[i] = m_u[i] + alpha * m_step[i];
+            evaluate(m_trial.data(), false);
+            double trialMerit = 0.0;
+            for (size_t i = 0; i < nu; ++i) trialMerit += m_res[i] * m_res[i];
+            accepted = trialMerit <= (1.0 - 1e-4 * alpha) * merit;
+            if (!accepted) alpha *= 0.5;
+        }
+        if (!accepted) {
+            // 残差已降到舍入误差水平, 无法再减小
+            m_residual = evaluate(m_u.data(), true);
+            return m_residual <= 100.0 * m_options.tolerance;
+        }
+        m_u.swap(m_trial);
+        m_residual = evaluate(m_u.data(), true);
+    }
+    return m_residual <= m_options.tolerance;
+}
+
+void GasEquilibrium::sensitivity(double T) {
+    // 固定未知数时 ∂ln n_k/∂T = h_k/RT² (定压) 或 (h_k/RT - 1)/T (定容); 由 J du/dT = -∂F/∂T 得到元素势的变化
+    size_t M = m_elem.size();
+    size_t K = m_spec.size();
+    size_t nu = m_u.size();
+    double shift = m_fixedPressure ? 0.0 : 1.0;
+    for (size_t i = 0; i < K; ++i) m_dlnn[i] = (m_work.h_RT[m_spec[i]] - shift) / T;
+
+    for (size_t m = 0; m < M; ++m) {
+        double scale = m_rowScale[m];
+        double sum = 0.0;
+        for (size_t i = 0; i < K; ++i) {
+            double a = m_A[i * M + m];
+            if (a == 0.0) continue;
+            double wt = scale == m_scale ? m_e[i] : std::exp(m_lnn[i] - scale);
+            sum += a * wt * m_dlnn[i];
+        }
+        m_rhs[m] = -sum / m_rowSum[m];
+    }
+    if (m_fixedPressure) {
+        double sum = 0.0;
+        for (size_t i = 0; i < K; ++i) sum += m_e[i] * m_dlnn[i];
+        m_rhs[M] = -sum / m_sumE;
+    }
+    m_lu = m_jac;
+    solveDense(m_lu.data(), m_rhs.data(), m_step.data(), nu, m_cols);
+
+    for (size_t i = 0; i < K; ++i) {
+        const double* a = &m_A[i * M];
+        double d = m_dlnn[i] + (m_fixedPressure ? m_step[M] : 0.0);
+        for (size_t j = 0; j < M; ++j) d += a[j] * m_step[j];
+        m_dlnn[i] = d;
+    }
+}
+
+void GasEquilibrium::equilibrate(IdealGasPhase& gas, Constraint constraint) {
+    double target = 0.0;
+    if (constraint == Constraint::HP) target = gas.enthalpy_mass();
+    else if (constraint == Constraint::SP) target = gas.entropy_mass();
+    else if (constraint == Constraint::UV) target = gas.intEnergy_mass();
+    equilibrate(gas, constraint, target);
+}
+
+void GasEquilibrium::equilibrate(IdealGasPhase& gas, Constraint constraint, double target) {
+    setup(gas);
+    m_fixedPressure = constraint != Constraint::UV;
+    m_iterations = 0;
+    m_temperatureIterations = 0;
+
+    const double R = GasConstant;
+    double P0 = gas.refPressure();
+    double P = gas.pressure();
+    double v = 1.0 / gas.density();
+
+    size_t M = m_elem.size();
+    size_t nu = M + (m_fixedPressure ? 1 : 0);
+    m_u.resize(nu);
+    m_trial.resize(nu);
+    m_res.resize(nu);
+    m_jac.resize(nu * nu);
+    m_step.resize(nu);
+    m_rhs.resize(nu);
+
+    // 定压时μ0含 ln(P/P0); 定容时 ln(n_k RT/(v P0)) 中的 ln(RT/(v P0))
+    auto lnShift = [&](double T) {
+        return m_fixedPressure ? std::log(P / P0) : std::log(R * T / (v * P0));
+    };
+
+    double T = gas.temperature();
+    m_warmStarted = m_options.warmStart && m_hasSolution;
+    if (m_warmStarted && constraint != Constraint::TP) T = m_T;
+    else if (constraint == Constraint::HP || constraint == Constraint::UV) T = std::max(T, ColdStartTemperature);
+    T = std::min(std::max(T, m_options.Tmin), m_options.Tmax);
+    if (constraint == Constraint::TP) T = gas.temperature();
+
+    // 先从已有的元素势 (热启动、上一个温度的预测值) 直接做Newton迭代; 不收敛或没有初值时
+    // 用不需要初值的Gordon-McBride迭代得到近似解, 再用Newton迭代收敛到容差
+    double lnN0 = -std::log(gas.meanMolecularWeight());
+    auto solveAt = [&](double Tnew, bool haveGuess) {
+        setTemperature(Tnew, lnShift(Tnew));
+        if (haveGuess && solveFixedTemperature()) return;
+        if (!solvePrimal(lnN0) || !solveFixedTemperature()) {
+            throw std::runtime_error("Equilibrium: element potential iteration did not converge at T = " +
+                std::to_string(Tnew) + " K");
+        }
+    };
+
+    if (m_warmStarted) {
+        for (size_t j = 0; j < M; ++j) m_u[j] = m_potentials[m_elem[j]];
+        if (m_fixedPressure) m_u[M] = m_lnMoles;
+    }
+    solveAt(T, m_warmStarted);
+
+    if (constraint != Constraint::TP) {
+        // 外层: 对温度做Newton迭代, 导数为平衡热容 (含组成变化); 保持根所在的区间,
+        // 越出区间或步长没有减半时二分 (外推的多项式可能使平衡焓在高温下不单调)
+        const double stepTol = 1e-9;
+        double lo = m_options.Tmin;
+        double hi = m_options.Tmax;
+        double lastStep = hi - lo;
+        bool triedTmin = false;
+        bool triedTmax = false;
+        for (;;) {
+            if (++m_temperatureIterations > m_options.maxTemperatureIterations) {
+                throw std::runtime_error("Equilibrium: temperature iteration did not converge");
+            }
+            sensitivity(T);
+            size_t K = m_spec.size();
+            double N = 0.0, h = 0.0, cp = 0.0, dh = 0.0, s = 0.0;
+            for (size_t i = 0; i < K; ++i) {
+                double n = std::exp(m_lnn[i]);
+                if (n == 0.0) continue;
+                size_t k = m_spec[i];
+                double hk = m_work.h_RT[k] - (m_fixedPressure ? 0.0 : 1.0);
+                N += n;
+                h += n * hk;
+                cp += n * (m_work.cp_R[k] - (m_fixedPressure ? 0.0 : 1.0));
+                dh += n * hk * m_dlnn[i];
+                s += n * (m_work.s_R[k] - m_lnn[i]);
+            }
+            double lnN = std::log(N);
+            double prop, dprop;
+            if (constraint == Constraint::SP) {
+                prop = R * (s + N * (lnN - std::log(P / P0)));
+                dprop = R * (cp + T * dh) / T;
+            }
+            else {
+                // HP: h = RT Σ n h/RT;  UV: u = RT Σ n (h/RT - 1)
+                prop = R * T * h;
+                dprop = R * (cp + T * dh);
+            }
+            double r = prop - target;
+            if ((r > 0.0 && T <= m_options.Tmin) || (r < 0.0 && T >= m_options.Tmax)) {
+                throw std::runtime_error("Equilibrium: no solution in [" + std::to_string(m_options.Tmin) +
+                    ", " + std::to_string(m_options.Tmax) + "] K");
+            }
+            if (r > 0.0) hi = T;
+            else lo = T;
+
+            double Tnew = T;
+            bool newton = dprop > 0.0;
+            if (newton) {
+                double step = r / dprop;
+                if (std::abs(step) <= stepTol * T) break;
+                Tnew = T - step;
+                newton = Tnew > lo && Tnew < hi && std::abs(step) <= 0.5 * lastStep;
+                // 越出搜索区间时先在端点求解一次, 目标值超出平衡性质的范围时不必二分到底
+                if (!newton && Tnew <= m_options.Tmin && lo == m_options.Tmin && !triedTmin) {
+                    Tnew = m_options.Tmin;
+                    newton = triedTmin = true;
+                }
+                else if (!newton && Tnew >= m_options.Tmax && hi == m_options.Tmax && !triedTmax) {
+                    Tnew = m_options.Tmax;
+                    newton = triedTmax = true;
+                }
+            }
+            if (!newton) {
+                Tnew = 0.5 * (lo + hi);
+                if (hi - lo <= 1e-14 * Tnew) {
+                    throw std::runtime_error("Equilibrium: no solution in [" + std::to_string(m_options.Tmin) +
+                        ", " + std::to_string(m_options.Tmax) + "] K");
+                }
+            }
+            // 一阶预测下一个温度的元素势 (温度变化大时直接用当前值)
+            double dT = Tnew - T;
+            lastStep = std::abs(dT);
+            if (std::abs(dT) <= 0.2 * T) {
+                for (size_t i = 0; i < nu; ++i) m_u[i] += m_step[i] * dT;
+            }
+            T = Tnew;
+            solveAt(T, true);
+        }
+    }
+
+    // 保存解并设置相的状态
+    size_t K = m_spec.size();
+    double N = 0.0;
+    for (size_t i = 0; i < K; ++i) N += std::exp(m_lnn[i]);
+    double lnN = std::log(N);
+    std::fill(m_x.begin(), m_x.end(), 0.0);
+    for (size_t i = 0; i < K; ++i) m_x[m_spec[i]] = std::exp(m_lnn[i] - lnN);
+    for (size_t j = 0; j < M; ++j) m_potentials[m_elem[j]] = m_u[j];
+    m_lnMoles = lnN;
+    m_T = T;
+    m_hasSolution = true;
+
+    // 不经过setPressure (其中有按atm解释小压力值的判断): 定压时压力不变, 定容时由setState_UV设定压力
+    gas.setTemperature(T);
+    gas.setMoleFractions(m_x.data());
+    if (!m_fixedPressure) gas.setState_UV(target, v, T);
+}
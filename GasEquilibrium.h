@@ -0,0 +1,116 @@
+#pragma once
+#include "IdealGasPhase.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+// 理想气体化学平衡 - 元素势方法 (Gibbs自由能最小)
+// 平衡时 μ_k/RT = Σ_m a_km π_m, 组成完全由元素势 π_m = λ_m/RT 决定: ln n_k = Σ_m a_km π_m - μ0_k/RT + ln N,
+// 未知数只有元素个数 (+1), 与组分数无关; 各组分的物质的量总为正, 痕量组分得到正确的指数小量而不会变成负值
+// 元素守恒方程取对数形式 ln(Σ_k a_km n_k) = ln b_m, 主量元素与痕量元素的残差都是相对误差
+// TP/UV 的固定温度问题 (定压或定容) 用阻尼Newton迭代求解元素势; HP/SP/UV 在外层对温度做Newton迭代,
+// 平衡热容由元素势对温度的灵敏度解析得到, 并用作下一个温度的一阶预测
+// 对象保存上一次的解 (元素势、总物质的量、温度), 求解相邻状态时作为初值 (热启动); 每个线程使用自己的对象
+class GasEquilibrium {
+public:
+    enum class Constraint { TP, HP, SP, UV };
+
+    struct Options {
+        double tolerance = 1e-12;               // 元素守恒方程 (对数形式) 的残差容差
+        int maxIterations = 100;                // 每个温度的Newton迭代上限
+        int maxTemperatureIterations = 100;     // 外层温度迭代上限
+        double Tmin = 200.0;                    // HP/SP/UV 的温度搜索区间 K
+        double Tmax = 6000.0;
+        bool warmStart = true;                  // 以上一次的解为初值 (否则由相的当前组成估计)
+    };
+
+    GasEquilibrium();
+    explicit GasEquilibrium(const Options& options);
+
+    // "TP", "HP", "SP", "UV" (字母顺序不限, 如 "PT"); 其他抛出 std::invalid_argument
+    static Constraint parseConstraint(const std::string& XY);
+
+    // 保持两个给定性质 (取相的当前值) 和元素组成不变, 把相设为平衡状态
+    // 混合物中不含的元素及含有这些元素的组分不参与计算 (平衡摩尔分数为0)
+    // 相中有没有热力学数据的组分 (addSpecies手动添加) 时抛出 std::invalid_argument; 不收敛时抛出 std::runtime_error
+    void equilibrate(IdealGasPhase& gas, Constraint constraint);
+    void equilibrate(IdealGasPhase& gas, const std::string& XY) { equilibrate(gas, parseConstraint(XY)); }
+    // 焓 (HP, J/kg)、熵 (SP, J/(kg·K)) 或内能 (UV, J/kg) 的目标值由target给出, 不取相的当前值;
+    // 用于冻结组成下达不到的状态 (如有焓亏损的燃烧产物); 压力或比容仍取相的当前值, TP时忽略target
+    void equilibrate(IdealGasPhase& gas, Constraint constraint, double target);
+
+    // 上一次求解的统计
+    int iterations() const { return m_iterations; }                         // 固定温度Newton迭代的总次数
+    int temperatureIterations() const { return m_temperatureIterations; }   // 外层温度迭代次数 (TP为0)
+    double residual() const { return m_residual; }                          // 最终的最大对数残差
+    bool warmStarted() const { return m_warmStarted; }
+
+    // 上一次的解: 元素势 λ_m/RT, 按 gas.elements() 的顺序 (混合物中不含的元素保持原值, 没有意义)
+    const std::vector<double>& elementPotentials() const { return m_potentials; }
+    double temperature() const { return m_T; }
+    bool hasSolution() const { return m_hasSolution; }
+    // 丢弃保存的解, 下一次由相的当前组成估计初值
+    void reset() { m_hasSolution = false; }
+
+    const Options& options() const { return m_options; }
+    void setOptions(const Options& options) { m_options = options; }
+
+private:
+    // 建立参与计算的元素、组分及组成矩阵, 计算元素的物质的量 b (kmol/kg)
+    void setup(const IdealGasPhase& gas);
+    // 给定温度下的标准化学势 μ0_k/RT (含压力或体积项)
+    void setTemperature(double T, double lnShift);
+    // 不需要初值的Gordon-McBride迭代 (从各组分等量开始), 收敛到中等精度后把元素势写入m_u;
+    // lnN为总物质的量的初值
+    bool solvePrimal(double lnN);
+    // 计算残差 (及Jacobian), 返回最大绝对残差
+    double evaluate(const double* u, bool jacobian);
+    // 固定温度的阻尼Newton迭代; 不收敛时返回false
+    bool solveFixedTemperature();
+    // 平衡组成对温度的灵敏度 d ln n_k/dT (写入m_dlnn), 需要在收敛的解上调用
+    void sensitivity(double T);
+
+    Options m_options;
+    std::shared_ptr<const SpeciesThermo> m_species;
+    std::shared_ptr<const ThermoTable> m_table;  // 与相相同的插值模式, 使平衡性质与相的性质一致
+    ThermoWorkspace m_work;
+
+    bool m_fixedPressure = true;                // 定压 (未知数含 ln N) 或定容
+    std::vector<size_t> m_elem;                 // 参与计算的元素
+    std::vector<size_t> m_spec;                 // 参与计算的组分
+    std::vector<double> m_A;                    // 组成矩阵 [组分][元素] (只含参与计算的部分)
+    std::vector<double> m_b;                    // 全部元素的物质的量 kmol/kg
+    std::vector<double> m_logB;                 // 参与计算的元素的 ln b
+    std::vector<double> m_mu0;                  // μ0_k/RT
+    std::vector<double> m_lnn;                  // ln n_k (kmol/kg)
+    std::vector<double> m_e;                    // exp(ln n_k - max)
+    std::vector<double> m_w;                    // 下溢时按行重新缩放的权重
+    std::vector<double> m_dlnn;                 // d ln n_k/dT (Gordon-McBride迭代中为 μ_k/RT 和修正量)
+    std::vector<double> m_gln;                  // Gordon-McBride迭代的 ln n_k
+    std::vector<double> m_rowScale;             // 各元素方程所用的缩放 (ln)
+    std::vector<double> m_rowSum;
+    double m_scale = 0.0;
+    double m_sumE = 0.0;
+
+    std::vector<double> m_u;                    // 未知数: π_m (, ln N)
+    std::vector<double> m_trial;
+    std::vector<double> m_res;
+    std::vector<double> m_jac;
+    std::vector<double> m_lu;
+    std::vector<double> m_step;
+    std::vector<double> m_rhs;
+    std::vector<size_t> m_cols;
+    std::vector<double> m_x;
+
+    // 保存的解
+    std::vector<double> m_potentials;
+    double m_lnMoles = 0.0;
+    double m_T = 0.0;
+    bool m_hasSolution = false;
+
+    // 统计
+    int m_iterations = 0;
+    int m_temperatureIterations = 0;
+    double m_residual = 0.0;
+    bool m_warmStarted = false;
+};
@@ -1,4 +1,5 @@
 #include "IdealGasPhase.h"
+#include "GasEquilibrium.h"
 #include <algorithm>
 #include <cmath>
 #include <sstream>
@@ -11,6 +12,7 @@ void Phase::setMoleFractions(const double* x) {
     if (!x) return;
     m_moleFractions.assign(x, x + nSpecies());
     normalizeComposition(m_moleFractions);
+    touchState();
     
     // 更新质量分数
     convertMoleToMass(m_moleFractions, m_massFractions);
@@ -37,6 +39,7 @@ void Phase::setMassFractions(const double* y) {
     if (!y) return;
     m_massFractions.assign(y, y + nSpecies());
     normalizeComposition(m_massFractions);
+    touchState();
     
     // 更新摩尔分数
     convertMassToMole(m_massFractions, m_moleFractions);
@@ -63,11 +66,17 @@ double Phase::meanMolecularWeight() const {
     if (m_moleFractions.empty() || m_molecularWeights.empty()) {
         return 28.96; // 默认空气分子量
     }
+    // 每个*_mass()和density()都要用到, 组成不变时只求和一次
+    if (m_meanMWVersion == m_stateVersion) {
+        return m_meanMW;
+    }
     
     double sum = 0.0;
     for (size_t i = 0; i < m_moleFractions.size(); ++i) {
         sum += m_moleFractions[i] * m_molecularWeights[i];
     }
+    m_meanMW = sum;
+    m_meanMWVersion = m_stateVersion;
     return sum;
 }
 
@@ -81,6 +90,7 @@ void Phase::resizeArrays() {
     size_t n = nSpecies();
     m_moleFractions.resize(n, 0.0);
     m_massFractions.resize(n, 0.0);
+    touchState();
     
     // 如果只有一个组分，设为1.0
     if (n == 1) {
@@ -92,7 +102,7 @@ void Phase::resizeArrays() {
 // IdealGasPhase 实现
 
 IdealGasPhase::IdealGasPhase() 
-    : Phase(), m_p0(OneAtm), m_pressure(OneAtm), m_tlast(-1.0) {
+    : Phase(), m_p0(OneAtm), m_pressure(OneAtm), m_speciesThermo(std::make_shared<const SpeciesThermo>()) {
     setName("IdealGas");
 }
 
@@ -106,64 +116,69 @@ void IdealGasPhase::addSpecies(const std::string& name, double mw) {
     Phase::addSpecies(name, mw);
     
     // Resize thermodynamic vectors to match the new species count
-    size_t n = nSpecies();
-    m_h0_RT.resize(n);
-    m_s0_R.resize(n);
-    m_cp0_R.resize(n);
-    m_g0_RT.resize(n);
-    
-    // Reset temperature cache to force recalculation
-    m_tlast = -1.0;
+    // (resize also resets the temperature cache to force recalculation)
+    m_work.resize(nSpecies());
+}
+
+IdealGasPhase::IdealGasPhase(const MechanismView& view, const std::string& phaseName)
+    : IdealGasPhase() {
+    initFromView(view, phaseName);
 }
 
 void IdealGasPhase::initFromYaml(const std::string& yamlFile, const std::string& phaseName) {
     try {
         // 加载热力学数据
-        m_thermoData = ChemistryVars::extractThermo(yamlFile);
-        
-        // 清除现有数据
-        m_speciesNames.clear();
-        m_molecularWeights.clear();
-        
-        // 添加组分
-        for (const auto& thermo : m_thermoData) {
-            // 计算分子量
-            double mw = 0.0;
-            for (const auto& elem : thermo.composition) {
-                // 简化的原子量表
-                std::map<std::string, double> atomicWeights = {
-                    {"H", 1.008}, {"C", 12.011}, {"N", 14.007}, {"O", 15.999},
-                    {"Ar", 39.948}, {"He", 4.003}, {"Ne", 20.180}, {"Kr", 83.798},
-                    {"Xe", 131.293}, {"S", 32.06}, {"P", 30.974}, {"Cl", 35.45},
-                    {"F", 18.998}, {"Br", 79.904}, {"I", 126.904}
-                };
-                
-                auto it = atomicWeights.find(elem.first);
-                if (it != atomicWeights.end()) {
-                    mw += it->second * elem.second;
-                }
-            }
-            
-            addSpecies(thermo.name, mw);
-        }
-        
-        // 初始化存储数组
-        size_t n = nSpecies();
-        m_h0_RT.resize(n);
-        m_s0_R.resize(n);
-        m_cp0_R.resize(n);
-        m_g0_RT.resize(n);
-        
-        // 如果指定了相名，使用它
-        if (!phaseName.empty()) {
-            setName(phaseName);
-        }
-        
+        initFromThermo(ChemistryVars::extractThermo(yamlFile), phaseName);
     } catch (const std::exception& e) {
         throw std::runtime_error("Failed to initialize from YAML: " + std::string(e.what()));
     }
 }
 
+void IdealGasPhase::initFromView(const MechanismView& view, const std::string& phaseName) {
+    // 只取视图中的组分, 不复制父机理的其余数据
+    std::vector<ChemistryVars::ThermoData> thermoData;
+    thermoData.reserve(view.nSpecies());
+    for (size_t k = 0; k < view.nSpecies(); ++k) {
+        thermoData.push_back(view.thermo(k));
+    }
+    initFromThermo(std::move(thermoData), phaseName);
+}
+
+IdealGasPhase::IdealGasPhase(std::shared_ptr<const SpeciesThermo> species, const std::string& phaseName)
+    : IdealGasPhase() {
+    initFromSpeciesThermo(std::move(species), phaseName);
+}
+
+void IdealGasPhase::initFromThermo(std::vector<ChemistryVars::ThermoData> thermoData, const std::string& phaseName) {
+    // 系数表和元素表只在建立数据库时计算一次
+    initFromSpeciesThermo(std::make_shared<const SpeciesThermo>(std::move(thermoData)), phaseName);
+}
+
+void IdealGasPhase::initFromSpeciesThermo(std::shared_ptr<const SpeciesThermo> species, const std::string& phaseName) {
+    if (!species) {
+        throw std::invalid_argument("IdealGasPhase: species thermo database is null");
+    }
+    m_speciesThermo = std::move(species);
+    m_thermoTable.reset();
+    
+    // 清除现有数据
+    m_speciesNames.clear();
+    m_molecularWeights.clear();
+    
+    const std::vector<double>& mw = m_speciesThermo->molecularWeights();
+    for (size_t k = 0; k < m_speciesThermo->nSpecies(); ++k) {
+        addSpecies(m_speciesThermo->species(k).name, mw[k]);
+    }
+    
+    // 初始化存储数组
+    m_work.resize(nSpecies());
+    
+    // 如果指定了相名，使用它
+    if (!phaseName.empty()) {
+        setName(phaseName);
+    }
+}
+
 void IdealGasPhase::setState_TPX(double T, double P, const std::string& X) {
     setTemperature(T);
     setPressure(P);
@@ -205,6 +220,123 @@ void IdealGasPhase::setState_TP(double T, double P) {
     setPressure(P);
 }
 
+const double IdealGasPhase::InversionTmin = 20.0;
+const double IdealGasPhase::InversionTmax = 20000.0;
+
+void IdealGasPhase::setState_HP(double h, double P, double Tguess) {
+    // 反求失败时恢复原来的压力和密度 (温度由solveTemperature恢复)
+    double P0 = m_pressure, rho0 = m_dens;
+    try {
+        setPressure(P);
+        solveTemperature(Inversion::Enthalpy, h, Tguess);
+    }
+    catch (...) {
+        m_pressure = P0;
+        setDensity(rho0);
+        throw;
+    }
+}
+
+void IdealGasPhase::setState_UV(double u, double v, double Tguess) {
+    solveTemperature(Inversion::IntEnergy, u, Tguess);
+    // 内能与密度无关, 温度确定后由状态方程得到压力 (直接设定, 不经过setPressure的单位判断)
+    m_pressure = GasConstant * temperature() / (meanMolecularWeight() * v);
+    touchState();
+}
+
+void IdealGasPhase::setState_SP(double s, double P, double Tguess) {
+    double P0 = m_pressure, rho0 = m_dens;
+    try {
+        setPressure(P);
+        solveTemperature(Inversion::Entropy, s, Tguess);
+    }
+    catch (...) {
+        m_pressure = P0;
+        setDensity(rho0);
+        throw;
+    }
+}
+
+void IdealGasPhase::equilibrate(const std::string& XY) {
+    GasEquilibrium solver;
+    solver.equilibrate(*this, XY);
+}
+
+void IdealGasPhase::solveTemperature(Inversion kind, double target, double Tguess) {
+    const int maxIterations = 100;
+    const double stepTol = 1e-9;        // 三阶收敛: 步长 < 1e-9 T 时剩余误差远小于舍入误差
+    const double widthTol = 1e-14;      // 二分时区间的相对宽度
+
+    // 组成不变的部分只算一次
+    double invW = 1.0 / meanMolecularWeight();
+    double sConst = kind == Inversion::Entropy ? -(sum_xlogx() + std::log(pressure() / m_p0)) : 0.0;
+
+    double lo = InversionTmin, hi = InversionTmax;
+    double T0 = temperature();
+    double T = Tguess > 0.0 ? Tguess : T0;
+    T = std::min(std::max(T, lo), hi);
+    m_inversionIterations = 0;
+    while (m_inversionIterations < maxIterations) {
+        ++m_inversionIterations;
+        setTemperature(T);
+        updateThermoDerivatives();
+
+        // f(T) 及其一、二阶导数 (质量基), 三个性质都随T单调增加
+        double cp = mean_X(m_work.cp_R) * GasConstant * invW;
+        double dcp = mean_X(m_work.dcp_R) * GasConstant * invW;
+        double f, df, d2f;
+        if (kind == Inversion::Entropy) {
+            f = (mean_X(m_work.s_R) + sConst) * GasConstant * invW;
+            df = cp / T;
+            d2f = (dcp - df) / T;
+        }
+        else {
+            f = mean_X(m_work.h_RT) * GasConstant * T * invW;
+            df = cp;
+            d2f = dcp;
+            if (kind == Inversion::IntEnergy) {
+                f -= GasConstant * T * invW;
+                df -= GasConstant * invW;
+            }
+        }
+        double residual = f - target;
+        if (residual == 0.0) return;
+        if (residual < 0.0) lo = T;
+        else hi = T;
+
+        // Halley修正的Newton步; 导数异常或越出区间时二分
+        // 步长小于容差时直接接受 (舍入后可能落在区间端点上)
+        double Tnew;
+        bool newton = df > 0.0;
+        if (newton) {
+            double step = residual / df;
+            double correction = 1.0 - 0.5 * step * d2f / df;
+            if (correction > 0.5) step /= correction;
+            Tnew = T - step;
+            if (std::abs(step) <= stepTol * T) {
+                setTemperature(Tnew);
+                return;
+            }
+            newton = Tnew > lo && Tnew < hi;
+        }
+        if (!newton) {
+            Tnew = 0.5 * (lo + hi);
+            if (hi - lo <= widthTol * Tnew) {
+                break;
+            }
+        }
+        T = Tnew;
+    }
+
+    // 根不在搜索区间内 (目标超出 [InversionTmin, InversionTmax] 对应的范围)
+    // 失败时恢复进入时的温度, 状态与调用前相同
+    if (lo == InversionTmin || hi == InversionTmax || m_inversionIterations >= maxIterations) {
+        setTemperature(T0);
+        throw std::runtime_error("IdealGasPhase: temperature inversion failed to converge");
+    }
+    setTemperature(0.5 * (lo + hi));
+}
+
 double IdealGasPhase::pressure() const {
     // 直接返回存储的压力值
     return m_pressure;
@@ -230,7 +362,12 @@ void IdealGasPhase::setPressure(double p) {
     if (p < 1e4) {
         p *= 101325.0; // Convert atm to Pa
     }
+    setPressurePa(p);
+}
+
+void IdealGasPhase::setPressurePa(double p) {
     m_pressure = p;
+    touchState();
     
     // 使用标准理想气体状态方程计算密度: ρ = P*M̄/(Ru*T)
     // 其中 M̄ 是平均分子量 (kg/kmol), Ru 是通用气体常数 (J/(kmol·K))
@@ -242,14 +379,12 @@ void IdealGasPhase::setPressure(double p) {
 }
 
 double IdealGasPhase::enthalpy_mole() const {
-    updateThermo();
-    return mean_X(m_h0_RT) * RT();
+    return mixtureTerm(MeanEnthalpy_RT) * RT();
 }
 
 double IdealGasPhase::entropy_mole() const {
-    updateThermo();
-    double s_mix = -sum_xlogx() * GasConstant; // 混合熵
-    double s_ref = mean_X(m_s0_R) * GasConstant;
+    double s_mix = -mixtureTerm(SumXlogX) * GasConstant; // 混合熵
+    double s_ref = mixtureTerm(MeanEntropy_R) * GasConstant;
     double s_pressure = -GasConstant * std::log(pressure() / m_p0);
     return s_ref + s_mix + s_pressure;
 }
@@ -259,8 +394,12 @@ double IdealGasPhase::gibbs_mole() const {
 }
 
 double IdealGasPhase::cp_mole() const {
-    updateThermo();
-    return mean_X(m_cp0_R) * GasConstant;
+    return mixtureTerm(MeanCp_R) * GasConstant;
+}
+
+double IdealGasPhase::dcp_mole_dT() const {
+    updateThermoDerivatives();
+    return mean_X(m_work.dcp_R) * GasConstant;
 }
 
 double IdealGasPhase::cv_mole() const {
@@ -271,9 +410,63 @@ double IdealGasPhase::intEnergy_mole() const {
     return enthalpy_mole() - RT();
 }
 
+void IdealGasPhase::getProperties(Properties& props) const {
+    updateThermo();
+    // 平均分子量和三个参考态性质的平均值在同一次遍历中求和 (求和顺序与单项函数相同);
+    // Σ X ln X 单独一个循环, 循环中调用log时四个累加量不必保存到内存
+    double mw = 0.0, h = 0.0, s = 0.0, cp = 0.0;
+    size_t n = std::min(m_moleFractions.size(), m_work.h_RT.size());
+    for (size_t k = 0; k < n; ++k) {
+        double x = m_moleFractions[k];
+        mw += x * m_molecularWeights[k];
+        h += x * m_work.h_RT[k];
+        s += x * m_work.s_R[k];
+        cp += x * m_work.cp_R[k];
+    }
+    double xlogx = sum_xlogx();
+    if (m_moleFractions.empty() || m_molecularWeights.empty()) {
+        mw = meanMolecularWeight();
+    }
+    else {
+        m_meanMW = mw;
+        m_meanMWVersion = stateVersion();
+    }
+    m_mixtureVersion = stateVersion();
+    m_mixture[MeanEnthalpy_RT] = h;
+    m_mixture[MeanEntropy_R] = s;
+    m_mixture[MeanCp_R] = cp;
+    m_mixture[SumXlogX] = xlogx;
+    m_mixtureValid = (1u << NMixtureTerms) - 1;
+
+    double T = temperature();
+    double P = pressure();
+    double RT = GasConstant * T;
+    props.temperature = T;
+    props.pressure = P;
+    props.meanMolecularWeight = mw;
+    props.density = T > 1e-100 && mw > 1e-100 ? (P * mw) / RT : m_dens;
+    props.molarDensity = props.density / mw;
+    props.enthalpy_mole = h * RT;
+    props.intEnergy_mole = props.enthalpy_mole - RT;
+    props.entropy_mole = s * GasConstant + -xlogx * GasConstant + -GasConstant * std::log(P / m_p0);
+    props.gibbs_mole = props.enthalpy_mole - T * props.entropy_mole;
+    props.cp_mole = cp * GasConstant;
+    props.cv_mole = props.cp_mole - GasConstant;
+    props.enthalpy_mass = props.enthalpy_mole / mw;
+    props.intEnergy_mass = props.intEnergy_mole / mw;
+    props.entropy_mass = props.entropy_mole / mw;
+    props.gibbs_mass = props.gibbs_mole / mw;
+    props.cp_mass = props.cp_mole / mw;
+    props.cv_mass = props.cv_mole / mw;
+    props.gamma = props.cp_mole / props.cv_mole;
+    props.soundSpeed = std::sqrt(props.gamma * RT / mw);
+}
+
 std::string IdealGasPhase::report() const {
     std::ostringstream oss;
     oss << std::fixed << std::setprecision(4);
+    Properties props;
+    getProperties(props);
     
     oss << "\n";
     oss << "*******************************************************************\n";
@@ -282,27 +475,27 @@ std::string IdealGasPhase::report() const {
     oss << "\n";
     
     // 基本状态信息
-    oss << "       temperature   " << std::setw(12) << temperature() << "  K\n";
-    oss << "          pressure   " << std::setw(12) << pressure() << "  Pa\n";
-    oss << "           density   " << std::setw(12) << density() << "  kg/m³\n";
-    oss << "  mean mol. weight   " << std::setw(12) << meanMolecularWeight() << "  kg/kmol\n";
+    oss << "       temperature   " << std::setw(12) << props.temperature << "  K\n";
+    oss << "          pressure   " << std::setw(12) << props.pressure << "  Pa\n";
+    oss << "           density   " << std::setw(12) << props.density << "  kg/m³\n";
+    oss << "  mean mol. weight   " << std::setw(12) << props.meanMolecularWeight << "  kg/kmol\n";
     oss << "\n";
     
     // 热力学性质
     oss << "                          1 kg             1 kmol\n";
     oss << "                     ---------------   ---------------\n";
-    oss << "          enthalpy   " << std::setw(12) << enthalpy_mass() << "     " 
-        << std::setw(12) << enthalpy_mole() << "     J\n";
-    oss << "   internal energy   " << std::setw(12) << intEnergy_mass() << "     " 
-        << std::setw(12) << intEnergy_mole() << "     J\n";
-    oss << "           entropy   " << std::setw(12) << entropy_mass() << "     " 
-        << std::setw(12) << entropy_mole() << "     J/K\n";
-    oss << "    Gibbs function   " << std::setw(12) << gibbs_mass() << "     " 
-        << std::setw(12) << gibbs_mole() << "     J\n";
-    oss << " heat capacity c_p   " << std::setw(12) << cp_mass() << "     " 
-        << std::setw(12) << cp_mole() << "     J/K\n";
-    oss << " heat capacity c_v   " << std::setw(12) << cv_mass() << "     " 
-        << std::setw(12) << cv_mole() << "     J/K\n";
+    oss << "          enthalpy   " << std::setw(12) << props.enthalpy_mass << "     " 
+        << std::setw(12) << props.enthalpy_mole << "     J\n";
+    oss << "   internal energy   " << std::setw(12) << props.intEnergy_mass << "     " 
+        << std::setw(12) << props.intEnergy_mole << "     J\n";
+    oss << "           entropy   " << std::setw(12) << props.entropy_mass << "     " 
+        << std::setw(12) << props.entropy_mole << "     J/K\n";
+    oss << "    Gibbs function   " << std::setw(12) << props.gibbs_mass << "     " 
+        << std::setw(12) << props.gibbs_mole << "     J\n";
+    oss << " heat capacity c_p   " << std::setw(12) << props.cp_mass << "     " 
+        << std::setw(12) << props.cp_mole << "     J/K\n";
+    oss << " heat capacity c_v   " << std::setw(12) << props.cv_mass << "     " 
+        << std::setw(12) << props.cv_mole << "     J/K\n";
     oss << "\n";
     
     // 组分信息
@@ -310,17 +503,15 @@ std::string IdealGasPhase::report() const {
         oss << "                         X             Y          Chem. Pot. / RT\n";
         oss << "                     -----------   -----------   ---------------\n";
         
+        std::vector<double> mu(nSpecies());
+        getChemPotentials(mu.data());
+        double rt = RT();
         for (size_t i = 0; i < nSpecies(); ++i) {
             if (moleFraction(i) > 1e-10 || massFraction(i) > 1e-10) {
-                double chemPot = 0.0; // 简化版本
-                if (i < m_g0_RT.size()) {
-                    chemPot = m_g0_RT[i] + std::log(std::max(moleFraction(i) * pressure() / m_p0, 1e-100));
-                }
-                
                 oss << std::setw(16) << speciesName(i) << "   " 
                     << std::setw(12) << moleFraction(i) << "   " 
                     << std::setw(12) << massFraction(i) << "   " 
-                    << std::setw(12) << chemPot << "\n";
+                    << std::setw(12) << mu[i] / rt << "\n";
             }
         }
     }
@@ -330,75 +521,57 @@ std::string IdealGasPhase::report() const {
 }
 
 void IdealGasPhase::updateThermo() const {
-    double T = temperature();
-    if (std::abs(T - m_tlast) < 1e-6) {
-        return; // 温度没有变化，不需要更新
-    }
-    
-    m_tlast = T;
+    // 插值表覆盖当前温度时用插值, 否则用共享的系数表精确计算; 只写本对象的缓存
+    m_speciesThermo->update(temperature(), m_work, m_thermoTable.get());
+}
+
+void IdealGasPhase::updateThermoDerivatives() const {
+    m_speciesThermo->updateDerivatives(temperature(), m_work);
+}
+
+std::shared_ptr<const ThermoTable> IdealGasPhase::enableThermoTable(const ThermoTable::Options& options) {
+    // 网格在各组分系数的分界温度处断开
+    ThermoTable::Options tableOptions = options;
+    std::vector<double> breaks = m_speciesThermo->breakpoints();
+    tableOptions.breakpoints.insert(tableOptions.breakpoints.end(), breaks.begin(), breaks.end());
     
-    // 计算各组分的热力学性质
-    for (size_t i = 0; i < nSpecies(); ++i) {
-        if (i >= m_thermoData.size()) {
-            // 使用默认值
-            m_h0_RT[i] = 0.0;
-            m_s0_R[i] = 0.0;
-            m_cp0_R[i] = 3.5; // 双原子分子默认值
-            continue;
-        }
-        
-        const auto& thermo = m_thermoData[i];
-        
-        // 选择合适的温度范围和系数
-        std::vector<double> coeffs;
-        if (!thermo.coefficients.low.empty() && !thermo.coefficients.high.empty()) {
-            // NASA7多项式
-            if (thermo.temperatureRanges.size() >= 3) {
-                double Tmid = thermo.temperatureRanges[1];
-                if (T <= Tmid) {
-                    coeffs = thermo.coefficients.low;
-                } else {
-                    coeffs = thermo.coefficients.high;
-                }
-            } else if (!thermo.coefficients.low.empty()) {
-                coeffs = thermo.coefficients.low;
-            }
-        }
-        
-        if (coeffs.size() >= 7) {
-            // NASA7多项式计算
-            m_h0_RT[i] = evaluateNASA(coeffs, T, 0); // 焓
-            m_s0_R[i] = evaluateNASA(coeffs, T, 1);  // 熵
-            m_cp0_R[i] = evaluateNASA(coeffs, T, 2); // 热容
-        } else {
-            // 使用默认值
-            m_h0_RT[i] = 0.0;
-            m_s0_R[i] = 0.0;
-            m_cp0_R[i] = 3.5;
-        }
-        
-        // 计算吉布斯自由能
-        m_g0_RT[i] = m_h0_RT[i] - m_s0_R[i];
+    std::shared_ptr<const SpeciesThermo> species = m_speciesThermo;
+    ThermoWorkspace work;
+    auto table = std::make_shared<const ThermoTable>(species->nSpecies(),
+        [species, &work](double T, double* hrt, double* sr, double* cpr) { species->evaluate(T, hrt, sr, cpr, work); },
+        tableOptions);
+    setThermoTable(table);
+    return table;
+}
+
+void IdealGasPhase::setThermoTable(std::shared_ptr<const ThermoTable> table) {
+    if (table && table->nSpecies() != m_speciesThermo->nSpecies()) {
+        throw std::invalid_argument("ThermoTable species count does not match phase");
     }
+    m_thermoTable = std::move(table);
+    m_work.invalidate();
+    touchState();
+}
+
+void IdealGasPhase::disableThermoTable() {
+    m_thermoTable.reset();
+    m_work.invalidate();
+    touchState();
 }
 
 double IdealGasPhase::evaluateNASA(const std::vector<double>& coeffs, double T, int property) const {
     if (coeffs.size() < 7) return 0.0;
     
-    double T2 = T * T;
-    double T3 = T2 * T;
-    double T4 = T3 * T;
-    
+    // Horner形式, 积分分母写成常数乘法 (整表求值见Nasa7Table中预缩放的系数)
     switch (property) {
         case 0: // H/RT
-            return coeffs[0] + coeffs[1] * T / 2.0 + coeffs[2] * T2 / 3.0 + 
-                   coeffs[3] * T3 / 4.0 + coeffs[4] * T4 / 5.0 + coeffs[5] / T;
+            return coeffs[0] + T * (coeffs[1] * 0.5 + T * (coeffs[2] * (1.0 / 3.0) +
+                   T * (coeffs[3] * 0.25 + T * coeffs[4] * 0.2))) + coeffs[5] / T;
         case 1: // S/R
-            return coeffs[0] * std::log(T) + coeffs[1] * T + coeffs[2] * T2 / 2.0 + 
-                   coeffs[3] * T3 / 3.0 + coeffs[4] * T4 / 4.0 + coeffs[6];
+            return coeffs[0] * std::log(T) + T * (coeffs[1] + T * (coeffs[2] * 0.5 +
+                   T * (coeffs[3] * (1.0 / 3.0) + T * coeffs[4] * 0.25))) + coeffs[6];
         case 2: // Cp/R
-            return coeffs[0] + coeffs[1] * T + coeffs[2] * T2 + 
-                   coeffs[3] * T3 + coeffs[4] * T4;
+            return coeffs[0] + T * (coeffs[1] + T * (coeffs[2] + T * (coeffs[3] + T * coeffs[4])));
         default:
             return 0.0;
     }
@@ -415,6 +588,25 @@ double IdealGasPhase::mean_X(const std::vector<double>& values) const {
     return sum;
 }
 
+double IdealGasPhase::mixtureTerm(MixtureTerm term) const {
+    if (m_mixtureVersion != stateVersion()) {
+        m_mixtureVersion = stateVersion();
+        m_mixtureValid = 0;
+    }
+    unsigned bit = 1u << term;
+    if (!(m_mixtureValid & bit)) {
+        if (term != SumXlogX) updateThermo();
+        switch (term) {
+        case MeanEnthalpy_RT: m_mixture[term] = mean_X(m_work.h_RT); break;
+        case MeanEntropy_R: m_mixture[term] = mean_X(m_work.s_R); break;
+        case MeanCp_R: m_mixture[term] = mean_X(m_work.cp_R); break;
+        default: m_mixture[term] = sum_xlogx(); break;
+        }
+        m_mixtureValid |= bit;
+    }
+    return m_mixture[term];
+}
+
 double IdealGasPhase::sum_xlogx() const {
     double sum = 0.0;
     for (size_t i = 0; i < m_moleFractions.size(); ++i) {
@@ -570,55 +762,131 @@ void Phase::convertMassToMole(const std::vector<double>& Y, std::vector<double>&
 
 // NASA多项式计算函数实现
 void IdealGasPhase::getEnthalpy_RT_ref(double* hrt) const {
-    double T = temperature();
-    for (size_t k = 0; k < nSpecies(); ++k) {
-        if (k < m_thermoData.size()) {
-            // 选择合适的温度范围的系数
-            const auto& coeffs = (T > 1000.0) ? m_thermoData[k].coefficients.high : m_thermoData[k].coefficients.low;
-            if (!coeffs.empty()) {
-                // 使用NASA多项式计算无量纲焓 H/(RT)
-                hrt[k] = evaluateNASA(coeffs, T, 0); // 0表示焓
-            } else {
-                hrt[k] = 0.0;
-            }
-        } else {
-            hrt[k] = 0.0;
-        }
-    }
+    updateThermo();
+    std::copy(m_work.h_RT.begin(), m_work.h_RT.end(), hrt);
 }
 
 void IdealGasPhase::getEntropy_R_ref(double* sr) const {
-    double T = temperature();
-    for (size_t k = 0; k < nSpecies(); ++k) {
-        if (k < m_thermoData.size()) {
-            // 选择合适的温度范围的系数
-            const auto& coeffs = (T > 1000.0) ? m_thermoData[k].coefficients.high : m_thermoData[k].coefficients.low;
-            if (!coeffs.empty()) {
-                // 使用NASA多项式计算无量纲熵 S/R
-                sr[k] = evaluateNASA(coeffs, T, 1); // 1表示熵
-            } else {
-                sr[k] = 0.0;
-            }
-        } else {
-            sr[k] = 0.0;
-        }
-    }
+    updateThermo();
+    std::copy(m_work.s_R.begin(), m_work.s_R.end(), sr);
 }
 
 void IdealGasPhase::getCp_R_ref(double* cpr) const {
-    double T = temperature();
-    for (size_t k = 0; k < nSpecies(); ++k) {
-        if (k < m_thermoData.size()) {
-            // 选择合适的温度范围的系数
-            const auto& coeffs = (T > 1000.0) ? m_thermoData[k].coefficients.high : m_thermoData[k].coefficients.low;
-            if (!coeffs.empty()) {
-                // 使用NASA多项式计算无量纲热容 Cp/R
-                cpr[k] = evaluateNASA(coeffs, T, 2); // 2表示热容
-            } else {
-                cpr[k] = 0.0;
-            }
-        } else {
-            cpr[k] = 0.0;
-        }
+    updateThermo();
+    std::copy(m_work.cp_R.begin(), m_work.cp_R.end(), cpr);
+}
+
+void IdealGasPhase::getCp_R_ddT(double* dcpr) const {
+    updateThermoDerivatives();
+    std::copy(m_work.dcp_R.begin(), m_work.dcp_R.end(), dcpr);
+}
+
+void IdealGasPhase::getEnthalpy_RT_ddT(double* dhrt) const {
+    updateThermoDerivatives();
+    double invT = 1.0 / temperature();
+    for (size_t k = 0; k < m_work.h_RT.size(); ++k) {
+        dhrt[k] = (m_work.cp_R[k] - m_work.h_RT[k]) * invT;
+    }
+}
+
+void IdealGasPhase::getEntropy_R_ddT(double* dsr) const {
+    updateThermoDerivatives();
+    double invT = 1.0 / temperature();
+    for (size_t k = 0; k < m_work.cp_R.size(); ++k) {
+        dsr[k] = m_work.cp_R[k] * invT;
+    }
+}
+
+// 标准态和偏摩尔性质: 由内核求得的缓存数组 (h/RT, s/R, cp/R, g/RT) 逐元素换算, 不分配内存
+void IdealGasPhase::getEnthalpy_RT(double* hrt) const {
+    getEnthalpy_RT_ref(hrt); // 理想气体的焓与压力无关
+}
+
+void IdealGasPhase::getEntropy_R(double* sr) const {
+    updateThermo();
+    double lnP = std::log(pressure() / m_p0);
+    for (size_t k = 0; k < m_work.s_R.size(); ++k) {
+        sr[k] = m_work.s_R[k] - lnP;
+    }
+}
+
+void IdealGasPhase::getGibbs_RT(double* grt) const {
+    updateThermo();
+    double lnP = std::log(pressure() / m_p0);
+    for (size_t k = 0; k < m_work.g_RT.size(); ++k) {
+        grt[k] = m_work.g_RT[k] + lnP;
+    }
+}
+
+void IdealGasPhase::getCp_R(double* cpr) const {
+    getCp_R_ref(cpr);
+}
+
+void IdealGasPhase::getIntEnergy_RT(double* urt) const {
+    updateThermo();
+    for (size_t k = 0; k < m_work.h_RT.size(); ++k) {
+        urt[k] = m_work.h_RT[k] - 1.0;
+    }
+}
+
+void IdealGasPhase::getStandardChemPotentials(double* mu0) const {
+    updateThermo();
+    double rt = RT();
+    double lnP = std::log(pressure() / m_p0);
+    for (size_t k = 0; k < m_work.g_RT.size(); ++k) {
+        mu0[k] = rt * (m_work.g_RT[k] + lnP);
+    }
+}
+
+void IdealGasPhase::getChemPotentials(double* mu) const {
+    updateThermo();
+    double rt = RT();
+    double lnP = std::log(pressure() / m_p0);
+    size_t n = std::min(m_work.g_RT.size(), m_moleFractions.size());
+    for (size_t k = 0; k < n; ++k) {
+        mu[k] = rt * (m_work.g_RT[k] + lnP + std::log(std::max(m_moleFractions[k], 1e-100)));
     }
 }
+
+void IdealGasPhase::getPartialMolarEnthalpies(double* hbar) const {
+    updateThermo();
+    double rt = RT();
+    for (size_t k = 0; k < m_work.h_RT.size(); ++k) {
+        hbar[k] = rt * m_work.h_RT[k];
+    }
+}
+
+void IdealGasPhase::getPartialMolarEntropies(double* sbar) const {
+    updateThermo();
+    double lnP = std::log(pressure() / m_p0);
+    size_t n = std::min(m_work.s_R.size(), m_moleFractions.size());
+    for (size_t k = 0; k < n; ++k) {
+        sbar[k] = GasConstant * (m_work.s_R[k] - lnP - std::log(std::max(m_moleFractions[k], 1e-100)));
+    }
+}
+
+void IdealGasPhase::getPartialMolarIntEnergies(double* ubar) const {
+    updateThermo();
+    double rt = RT();
+    for (size_t k = 0; k < m_work.h_RT.size(); ++k) {
+        ubar[k] = rt * (m_work.h_RT[k] - 1.0);
+    }
+}
+
+void IdealGasPhase::getPartialMolarCp(double* cpbar) const {
+    updateThermo();
+    for (size_t k = 0; k < m_work.cp_R.size(); ++k) {
+        cpbar[k] = GasConstant * m_work.cp_R[k];
+    }
+}
+
+void IdealGasPhase::getPartialMolarVolumes(double* vbar) const {
+    std::fill(vbar, vbar + nSpecies(), RT() / pressure());
+}
+
+void IdealGasPhase::getThermo_ref(double* hrt, double* sr, double* cpr) const {
+    updateThermo();
+    std::copy(m_work.h_RT.begin(), m_work.h_RT.end(), hrt);
+    std::copy(m_work.s_R.begin(), m_work.s_R.end(), sr);
+    std::copy(m_work.cp_R.begin(), m_work.cp_R.end(), cpr);
+}
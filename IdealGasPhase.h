@@ -1,6 +1,10 @@
 #pragma once
 #include "ChemistryVars.h"
 #include "ChemistryIO.h"
+#include "MechanismView.h"
+#include "ElementTable.h"
+#include "SpeciesThermo.h"
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <map>
@@ -19,9 +23,12 @@ public:
 
     // 基本属性访问
     virtual double temperature() const { return m_temp; }
-    virtual void setTemperature(double t) { m_temp = t; }
+    virtual void setTemperature(double t) { m_temp = t; touchState(); }
       virtual double density() const { return m_dens; }
-    virtual void setDensity(double d) { m_dens = d; }
+    virtual void setDensity(double d) { m_dens = d; touchState(); }
+
+    // 状态版本: 改变温度、密度、压力、组成或组分表的设置函数都使其加一, 依赖状态的缓存以它为键
+    uint64_t stateVersion() const { return m_stateVersion; }
     
     virtual double molarDensity() const { return m_dens / meanMolecularWeight(); }
     
@@ -69,6 +76,8 @@ public:
     
 protected:
     virtual void resizeArrays();
+    // 直接修改状态成员的子类函数在修改后调用
+    void touchState() { ++m_stateVersion; }
       // 辅助函数声明
     void parseComposition(const std::string& comp, std::vector<double>& fractions, bool isMass = false);
     void parseCompositionMap(const std::map<std::string, double>& comp, std::vector<double>& fractions, bool isMass = false);
@@ -84,15 +93,30 @@ protected:
     std::vector<double> m_moleFractions;        // 摩尔分数
     std::vector<double> m_massFractions;        // 质量分数
     std::vector<double> m_molecularWeights;     // 分子量 kg/kmol
+
+    // 平均分子量的缓存 (子类一次遍历求出时可以直接写入)
+    mutable uint64_t m_meanMWVersion = UINT64_MAX;  // m_meanMW对应的状态版本
+    mutable double m_meanMW = 0.0;
+
+private:
+    uint64_t m_stateVersion = 0;
 };
 
 // 理想气体相类
+// 系数数据在只读的SpeciesThermo中, 由复制的相对象共享; 相对象本身只有状态和求值缓存,
+// 多线程计算时每个线程使用自己的副本 (复制开销与组分数成正比, 不复制系数)
 class IdealGasPhase : public Phase {
 public:
     IdealGasPhase();
     IdealGasPhase(const std::string& yamlFile, const std::string& phaseName = "");
+    explicit IdealGasPhase(const MechanismView& view, const std::string& phaseName = "");
+    explicit IdealGasPhase(std::shared_ptr<const SpeciesThermo> species, const std::string& phaseName = "");
     virtual ~IdealGasPhase() = default;    // 从YAML文件初始化
     void initFromYaml(const std::string& yamlFile, const std::string& phaseName = "");
+    // 从子机理视图初始化 (组分顺序与视图一致)
+    void initFromView(const MechanismView& view, const std::string& phaseName = "");
+    // 使用已有的组分数据库 (不复制系数)
+    void initFromSpeciesThermo(std::shared_ptr<const SpeciesThermo> species, const std::string& phaseName = "");
 
     // Override addSpecies to resize thermodynamic vectors
     virtual void addSpecies(const std::string& name, double mw) override;    // 状态设置函数
@@ -102,9 +126,28 @@ public:
     void setState_TPY(double T, double P, const std::string& Y);
     void setState_TPY(double T, double P, const double* Y);
     void setState_TPY(double T, double P, const std::map<std::string, double>& Y);
-    void setState_TP(double T, double P);    // 压力相关
+    void setState_TP(double T, double P);
+
+    // 由质量比焓/内能/熵反求温度 (组成不变): 用解析的cp及其导数做Newton迭代 (三阶修正),
+    // 热启动初值通常2-3次收敛到机器精度; 步长越出有效区间时退回二分, 始终保持根在区间内
+    // Tguess <= 0 时以当前温度为初值; 无解时抛出 std::runtime_error, 温度、压力和密度保持调用前的值
+    void setState_HP(double h, double P, double Tguess = -1.0);     // h: J/kg, P: Pa
+    void setState_UV(double u, double v, double Tguess = -1.0);     // u: J/kg, v: m³/kg
+    void setState_SP(double s, double P, double Tguess = -1.0);     // s: J/(kg·K), P: Pa
+    // 化学平衡: 保持 "TP", "HP", "SP" 或 "UV" 及元素组成不变 (元素势方法, 见GasEquilibrium)
+    // 每次调用由当前组成估计初值; 需要对一系列相邻状态热启动时直接使用GasEquilibrium对象
+    void equilibrate(const std::string& XY);
+    // 上一次反求温度的性质计算次数
+    int inversionIterations() const { return m_inversionIterations; }
+    // 反求温度的搜索区间 K
+    static const double InversionTmin;
+    static const double InversionTmax;
+
+    // 压力相关
     virtual double pressure() const override;
     virtual void setPressure(double p);
+    // 按Pa设定压力, 不做小于1e4时按atm换算的判断 (温度和组成不变)
+    void setPressurePa(double p);
     
     // 密度相关 - 重写基类方法以使用理想气体状态方程
     virtual double density() const override;
@@ -125,46 +168,131 @@ public:
     virtual double cv_mass() const { return cv_mole() / meanMolecularWeight(); }
     virtual double intEnergy_mass() const { return intEnergy_mole() / meanMolecularWeight(); }
 
+    // 当前状态的全部混合物性质, 与对应的单项函数结果相同
+    struct Properties {
+        double temperature = 0.0;               // K
+        double pressure = 0.0;                  // Pa
+        double meanMolecularWeight = 0.0;       // kg/kmol
+        double density = 0.0;                   // kg/m³
+        double molarDensity = 0.0;              // kmol/m³
+        double enthalpy_mole = 0.0;             // J/kmol
+        double intEnergy_mole = 0.0;            // J/kmol
+        double entropy_mole = 0.0;              // J/(kmol·K)
+        double gibbs_mole = 0.0;                // J/kmol
+        double cp_mole = 0.0;                   // J/(kmol·K)
+        double cv_mole = 0.0;                   // J/(kmol·K)
+        double enthalpy_mass = 0.0;             // J/kg
+        double intEnergy_mass = 0.0;            // J/kg
+        double entropy_mass = 0.0;              // J/(kg·K)
+        double gibbs_mass = 0.0;                // J/kg
+        double cp_mass = 0.0;                   // J/(kg·K)
+        double cv_mass = 0.0;                   // J/(kg·K)
+        double gamma = 0.0;                     // cp/cv
+        double soundSpeed = 0.0;                // 冻结声速 m/s
+    };
+    // 一次遍历组分得到全部混合物求和 (同时写入混合物缓存, 之后同一状态的单项函数不再求和)
+    void getProperties(Properties& props) const;
+
+    // 温度导数 (定压、定组成), 由多项式解析求导, 与性质在同一次内核遍历中计算
+    virtual double dcp_mole_dT() const;                                 // J/(kmol·K²)
+    double dh_mole_dT() const { return cp_mole(); }                     // J/(kmol·K)
+    double ds_mole_dT() const { return cp_mole() / temperature(); }     // J/(kmol·K²)
+    double du_mole_dT() const { return cv_mole(); }                     // J/(kmol·K)
+    double dcp_mass_dT() const { return dcp_mole_dT() / meanMolecularWeight(); }
+
+    // 各组分参考态性质的温度导数 1/K, 数组长度为nSpecies
+    void getCp_R_ddT(double* dcpr) const;                               // d(cp/R)/dT
+    void getEnthalpy_RT_ddT(double* dhrt) const;                        // (cp/R - h/RT)/T
+    void getEntropy_R_ddT(double* dsr) const;                           // (cp/R)/T
+
+    // 各组分的标准态性质 (当前T、P下的纯组分), 数组长度为nSpecies
+    void getEnthalpy_RT(double* hrt) const;                             // h°/RT
+    void getEntropy_R(double* sr) const;                                // s°/R = s°(P0)/R - ln(P/P0)
+    void getGibbs_RT(double* grt) const;                                // g°/RT = g°(P0)/RT + ln(P/P0)
+    void getCp_R(double* cpr) const;                                    // cp°/R
+    void getIntEnergy_RT(double* urt) const;                            // u°/RT = h°/RT - 1
+    void getStandardChemPotentials(double* mu0) const;                  // μ° = RT g°/RT, J/kmol
+
+    // 各组分的偏摩尔性质, 数组长度为nSpecies (ln X_k 中的X_k不小于1e-100)
+    void getChemPotentials(double* mu) const;                           // μ° + RT ln X_k, J/kmol
+    void getPartialMolarEnthalpies(double* hbar) const;                 // J/kmol
+    void getPartialMolarEntropies(double* sbar) const;                  // s° - R ln X_k, J/(kmol·K)
+    void getPartialMolarIntEnergies(double* ubar) const;                // J/kmol
+    void getPartialMolarCp(double* cpbar) const;                        // J/(kmol·K)
+    void getPartialMolarVolumes(double* vbar) const;                    // RT/P, m³/kmol
+
     // 输出报告
     virtual std::string report() const;
 
     // 获取参考状态压力
     double refPressure() const { return m_p0; }
 
+    // 元素表及组成矩阵 (由YAML或视图初始化时建立)
+    const ElementTable& elements() const { return m_speciesThermo->elements(); }
+    size_t nElements() const { return elements().nElements(); }
+
+    // 只读的组分热力学数据库, 可用来构造共享系数的其他相对象
+    const std::shared_ptr<const SpeciesThermo>& speciesThermo() const { return m_speciesThermo; }
+
+    // 参考态性质插值模式: 在 [Tmin, Tmax] 内用插值表代替多项式求值, 范围外仍精确计算
+    // 返回建立的表 (只读, 可与其他相共享); 重新初始化机理时自动关闭
+    std::shared_ptr<const ThermoTable> enableThermoTable(const ThermoTable::Options& options);
+    void setThermoTable(std::shared_ptr<const ThermoTable> table);
+    void disableThermoTable();
+    const std::shared_ptr<const ThermoTable>& thermoTable() const { return m_thermoTable; }
+
+    // 只读系数表 (批量计算等外部求值器使用)
+    const Nasa7Table& nasa7Table() const { return m_speciesThermo->nasa7(); }
+    const Nasa9Table& nasa9Table() const { return m_speciesThermo->nasa9(); }
+
     // 工具函数
     double RT() const { return GasConstant * temperature(); }
     
 protected:
     // 更新热力学数据
     virtual void updateThermo() const;
+    // 同时更新 d(cp/R)/dT (总是精确计算, 不使用插值表)
+    void updateThermoDerivatives() const;
     
     // 计算参考状态热力学性质
     virtual void getEnthalpy_RT_ref(double* hrt) const;
     virtual void getEntropy_R_ref(double* sr) const;
     virtual void getCp_R_ref(double* cpr) const;
+    // 一次得到三个性质 (对应同一次内核求值)
+    virtual void getThermo_ref(double* hrt, double* sr, double* cpr) const;
     
     // NASA多项式计算
     virtual double evaluateNASA(const std::vector<double>& coeffs, double T, int property) const;
     
+    // 反求温度: 目标为质量比焓、内能或熵 (压力和组成已经设定)
+    enum class Inversion { Enthalpy, IntEnergy, Entropy };
+    void solveTemperature(Inversion kind, double target, double Tguess);
+    
     // 辅助函数
     virtual double mean_X(const std::vector<double>& values) const;
     virtual double sum_xlogx() const;
+
+    // 混合物求和 (Σ X_k h_k/RT 等) 的缓存值: 状态版本未变时直接返回, 每项在第一次使用时计算
+    enum MixtureTerm { MeanEnthalpy_RT, MeanEntropy_R, MeanCp_R, SumXlogX, NMixtureTerms };
+    double mixtureTerm(MixtureTerm term) const;
     
 private:
     // 参考状态压力
     double m_p0;                                // Pa
     double m_pressure;                          // 当前压力 Pa
     
-    // 热力学数据存储
-    std::vector<ChemistryVars::ThermoData> m_thermoData;
+    // 热力学数据存储 (只读, 共享)
+    std::shared_ptr<const SpeciesThermo> m_speciesThermo;
+    std::shared_ptr<const ThermoTable> m_thermoTable;   // 插值模式 (为空时精确计算)
     
-    // 临时存储数组 (mutable for const functions)
-    mutable std::vector<double> m_h0_RT;        // 无量纲参考焓
-    mutable std::vector<double> m_s0_R;         // 无量纲参考熵
-    mutable std::vector<double> m_cp0_R;        // 无量纲参考热容
-    mutable std::vector<double> m_g0_RT;        // 无量纲参考吉布斯能
-    mutable double m_tlast;                     // 上次计算的温度
+    // 本对象的求值缓存 (mutable for const functions): h/RT, s/R, cp/R, g/RT 及其温度
+    mutable ThermoWorkspace m_work;
+    mutable uint64_t m_mixtureVersion = UINT64_MAX;     // m_mixture对应的状态版本
+    mutable unsigned m_mixtureValid = 0;                // 已计算的项 (按MixtureTerm的位)
+    mutable double m_mixture[NMixtureTerms] = {};
+    int m_inversionIterations = 0;
       // 内部辅助函数
+    void initFromThermo(std::vector<ChemistryVars::ThermoData> thermoData, const std::string& phaseName);
     void parseComposition(const std::string& comp, std::vector<double>& fractions, bool isMass = false);
     void parseCompositionMap(const std::map<std::string, double>& comp, std::vector<double>& fractions, bool isMass = false);
     void normalizeComposition(std::vector<double>& fractions);
@@ -0,0 +1,232 @@
+#include "MechanismAnalytics.h"
+#include "ElementTable.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <unordered_map>
+
+namespace {
+
+std::string jsonString(const std::string& s) {
+    std::string out = "\"";
+    for (char c : s) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out + "\"";
+}
+
+std::string jsonNumber(double v) {
+    if (!std::isfinite(v)) return "null";
+    // 能精确还原的最短表示
+    char buf[32];
+    for (int precision = 15; precision <= 17; ++precision) {
+        std::snprintf(buf, sizeof(buf), "%.*g", precision, v);
+        if (std::strtod(buf, nullptr) == v) break;
+    }
+    return buf;
+}
+
+std::string jsonRange(const MechanismAnalytics::Range& r) {
+    return "{\"min\": " + jsonNumber(r.min) + ", \"max\": " + jsonNumber(r.max) +
+        ", \"count\": " + std::to_string(r.count) + "}";
+}
+
+std::string jsonStrings(const std::vector<std::string>& values) {
+    std::string out = "[";
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (i) out += ", ";
+        out += jsonString(values[i]);
+    }
+    return out + "]";
+}
+
+} // namespace
+
+void MechanismAnalytics::Range::add(double v) {
+    if (count == 0 || v < min) min = v;
+    if (count == 0 || v > max) max = v;
+    count++;
+}
+
+bool MechanismAnalytics::Report::clean() const {
+    return imbalances.empty() && unknownSpecies.empty() && duplicateIssues.empty() && elementError.empty();
+}
+
+MechanismAnalytics::Report MechanismAnalytics::analyze(const ChemistryVars::MechanismData& mechanism) {
+    ReactionIndex index(mechanism.reactions);
+    return analyze(mechanism, index);
+}
+
+MechanismAnalytics::Report MechanismAnalytics::analyze(const ChemistryVars::MechanismData& mechanism,
+    const ReactionIndex& index) {
+    Report report;
+    report.nReactions = mechanism.reactions.size();
+    report.nSpecies = mechanism.thermoSpecies.size();
+    report.nTransport = mechanism.transportSpecies.size();
+
+    std::unordered_map<std::string, size_t> speciesIndex;
+    speciesIndex.reserve(report.nSpecies);
+    report.species.resize(report.nSpecies);
+    for (size_t k = 0; k < report.nSpecies; ++k) {
+        report.species[k].name = mechanism.thermoSpecies[k].name;
+        speciesIndex.emplace(mechanism.thermoSpecies[k].name, k);
+    }
+    auto find = [&speciesIndex](const std::string& name) {
+        auto it = speciesIndex.find(name);
+        return it != speciesIndex.end() ? it->second : std::string::npos;
+    };
+
+    ElementTable elements;
+    try {
+        elements = ElementTable(mechanism.thermoSpecies);
+    } catch (const std::exception& e) {
+        report.elementError = e.what();
+    }
+    size_t nel = report.elementError.empty() ? elements.nElements() : 0;
+    std::vector<double> delta(nel);
+
+    // 对每个反应只访问一次
+    for (size_t i = 0; i < report.nReactions; ++i) {
+        const auto& reaction = mechanism.reactions[i];
+        const ReactionIndex::Stoichiometry& st = index.stoichiometry(i);
+
+        report.typeHistogram[reaction.type.empty() ? "elementary" : reaction.type]++;
+        if (st.reversible) report.nReversible++;
+        if (reaction.isDuplicate) report.nDuplicate++;
+        if (!reaction.rateConstant.plogData.empty()) report.nPlog++;
+        if (!reaction.efficiencies.empty()) report.nWithEfficiencies++;
+        if (!reaction.orders.empty()) report.nWithOrders++;
+
+        report.A.add(reaction.rateConstant.A);
+        report.b.add(reaction.rateConstant.b);
+        report.Ea.add(reaction.rateConstant.Ea);
+        if (reaction.lowPressure.A != 0.0) {
+            report.lowA.add(reaction.lowPressure.A);
+            report.lowB.add(reaction.lowPressure.b);
+            report.lowEa.add(reaction.lowPressure.Ea);
+        }
+
+        std::fill(delta.begin(), delta.end(), 0.0);
+        bool known = true;
+        for (int side = 0; side < 2; ++side) {
+            const auto& list = side == 0 ? st.reactants : st.products;
+            double sign = side == 0 ? -1.0 : 1.0;
+            for (const auto& sp : list) {
+                size_t k = find(sp.first);
+                if (k == std::string::npos) {
+                    report.unknownSpecies.push_back({ i, sp.first });
+                    known = false;
+                    continue;
+                }
+                (side == 0 ? report.species[k].asReactant : report.species[k].asProduct)++;
+                for (size_t m = 0; m < nel; ++m) {
+                    delta[m] += sign * sp.second * elements.nAtoms(k, m);
+                }
+            }
+        }
+
+        if (st.thirdBody.size() > 3 && st.thirdBody != "(+M)") {
+            std::string collider = st.thirdBody.substr(2, st.thirdBody.size() - 3);
+            size_t k = find(collider);
+            if (k != std::string::npos) report.species[k].asCollider++;
+            else report.unknownSpecies.push_back({ i, collider });
+        }
+        for (const auto& eff : reaction.efficiencies) {
+            size_t k = find(eff.first);
+            if (k != std::string::npos) report.species[k].asCollider++;
+        }
+
+        if (known) {
+            for (size_t m = 0; m < nel; ++m) {
+                if (std::abs(delta[m]) > 1e-8) {
+                    report.imbalances.push_back({ i, elements.elementName(m), delta[m] });
+                }
+            }
+        }
+    }
+
+    report.duplicateIssues = index.checkDuplicates();
+
+    for (const auto& usage : report.species) {
+        if (usage.asReactant + usage.asProduct + usage.asCollider == 0) {
+            report.unreferencedSpecies.push_back(usage.name);
+        }
+    }
+
+    std::unordered_map<std::string, bool> hasTransport;
+    for (const auto& tr : mechanism.transportSpecies) hasTransport[tr.name] = true;
+    if (!mechanism.transportSpecies.empty()) {
+        for (const auto& usage : report.species) {
+            if (!hasTransport.count(usage.name)) report.speciesWithoutTransport.push_back(usage.name);
+        }
+    }
+
+    return report;
+}
+
+std::string MechanismAnalytics::Report::toJson() const {
+    std::ostringstream out;
+    out << "{\n";
+    out << "  \"reactions\": " << nReactions << ",\n";
+    out << "  \"species\": " << nSpecies << ",\n";
+    out << "  \"transport\": " << nTransport << ",\n";
+    out << "  \"reversible\": " << nReversible << ",\n";
+    out << "  \"duplicate\": " << nDuplicate << ",\n";
+    out << "  \"plog\": " << nPlog << ",\n";
+    out << "  \"withEfficiencies\": " << nWithEfficiencies << ",\n";
+    out << "  \"withOrders\": " << nWithOrders << ",\n";
+
+    out << "  \"types\": {";
+    bool first = true;
+    for (const auto& entry : typeHistogram) {
+        out << (first ? "" : ", ") << jsonString(entry.first) << ": " << entry.second;
+        first = false;
+    }
+    out << "},\n";
+
+    out << "  \"parameters\": {\"A\": " << jsonRange(A) << ", \"b\": " << jsonRange(b)
+        << ", \"Ea\": " << jsonRange(Ea) << ", \"lowA\": " << jsonRange(lowA)
+        << ", \"lowB\": " << jsonRange(lowB) << ", \"lowEa\": " << jsonRange(lowEa) << "},\n";
+
+    out << "  \"speciesUsage\": [";
+    for (size_t k = 0; k < species.size(); ++k) {
+        const SpeciesUsage& u = species[k];
+        out << (k ? ",\n    " : "\n    ") << "{\"name\": " << jsonString(u.name)
+            << ", \"reactant\": " << u.asReactant << ", \"product\": " << u.asProduct
+            << ", \"collider\": " << u.asCollider << "}";
+    }
+    out << (species.empty() ? "],\n" : "\n  ],\n");
+
+    out << "  \"imbalances\": [";
+    for (size_t n = 0; n < imbalances.size(); ++n) {
+        out << (n ? ", " : "") << "{\"reaction\": " << imbalances[n].reaction
+            << ", \"element\": " << jsonString(imbalances[n].element)
+            << ", \"delta\": " << jsonNumber(imbalances[n].delta) << "}";
+    }
+    out << "],\n";
+
+    out << "  \"unknownSpecies\": [";
+    for (size_t n = 0; n < unknownSpecies.size(); ++n) {
+        out << (n ? ", " : "") << "{\"reaction\": " << unknownSpecies[n].reaction
+            << ", \"name\": " << jsonString(unknownSpecies[n].name) << "}";
+    }
+    out << "],\n";
+
+    out << "  \"duplicateIssues\": [";
+    for (size_t n = 0; n < duplicateIssues.size(); ++n) {
+        const auto& issue = duplicateIssues[n];
+        out << (n ? ", " : "") << "{\"reaction\": " << issue.reaction << ", \"kind\": "
+            << (issue.kind == ReactionIndex::DuplicateIssue::Kind::Undeclared ? "\"undeclared\"" : "\"missingPartner\"")
+            << ", \"equation\": " << jsonString(issue.equation) << "}";
+    }
+    out << "],\n";
+
+    out << "  \"unreferencedSpecies\": " << jsonStrings(unreferencedSpecies) << ",\n";
+    out << "  \"speciesWithoutTransport\": " << jsonStrings(speciesWithoutTransport) << ",\n";
+    out << "  \"elementError\": " << jsonString(elementError) << "\n";
+    out << "}\n";
+    return out.str();
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include "ChemistryVars.h"
+#include "ReactionIndex.h"
+#include <map>
+#include <string>
+#include <vector>
+
+// 机理分析 - 在已解析的机理(ReactionIndex)上做一次线性扫描, 得到结构化的统计结果
+// 用作机理修订的检查门槛: 组分参与次数、反应类型分布、元素守恒、参数范围、未引用组分
+class MechanismAnalytics {
+public:
+    // 组分参与情况
+    struct SpeciesUsage {
+        std::string name;
+        size_t asReactant = 0;
+        size_t asProduct = 0;
+        size_t asCollider = 0;      // 第三体效率或指定碰撞体
+    };
+
+    // 参数范围
+    struct Range {
+        double min = 0.0;
+        double max = 0.0;
+        size_t count = 0;
+
+        void add(double v);
+    };
+
+    // 元素不守恒
+    struct ElementImbalance {
+        size_t reaction;
+        std::string element;
+        double delta;               // 产物 - 反应物
+    };
+
+    // 方程式中引用了未定义的组分
+    struct UnknownSpecies {
+        size_t reaction;
+        std::string name;
+    };
+
+    struct Report {
+        size_t nReactions = 0;
+        size_t nSpecies = 0;
+        size_t nTransport = 0;
+
+        std::vector<SpeciesUsage> species;              // 与thermoSpecies顺序相同
+        std::map<std::string, size_t> typeHistogram;    // 未指定类型记为 "elementary"
+        size_t nReversible = 0;
+        size_t nDuplicate = 0;
+        size_t nPlog = 0;
+        size_t nWithEfficiencies = 0;
+        size_t nWithOrders = 0;
+
+        // 参数范围 (按文件单位, 不做换算)
+        Range A, b, Ea;
+        Range lowA, lowB, lowEa;
+
+        std::vector<ElementImbalance> imbalances;
+        std::vector<UnknownSpecies> unknownSpecies;
+        std::vector<ReactionIndex::DuplicateIssue> duplicateIssues;
+        std::vector<std::string> unreferencedSpecies;   // 未出现在任何反应中的组分
+        std::vector<std::string> speciesWithoutTransport;
+        std::string elementError;                       // 元素表建立失败时的信息 (此时不做元素守恒检查)
+
+        // 无元素不守恒、未知组分和重复反应问题
+        bool clean() const;
+        std::string toJson() const;
+    };
+
+    static Report analyze(const ChemistryVars::MechanismData& mechanism);
+    // 复用已建立的索引 (index须由mechanism.reactions建立)
+    static Report analyze(const ChemistryVars::MechanismData& mechanism, const ReactionIndex& index);
+};
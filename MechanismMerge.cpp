@@ -0,0 +1,275 @@
+#include "MechanismMerge.h"
+#include "ReactionIndex.h"
+#include <cstring>
+#include <map>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace {
+
+// FNV-1a 增量哈希
+struct Hasher {
+    uint64_t h = 14695981039346656037ULL;
+
+    void bytes(const void* data, size_t n) {
+        const unsigned char* p = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < n; ++i) {
+            h ^= p[i];
+            h *= 1099511628211ULL;
+        }
+    }
+    void add(double v) {
+        if (v == 0.0) v = 0.0;      // +0 与 -0 视为相同
+        uint64_t bits;
+        std::memcpy(&bits, &v, sizeof(bits));
+        bytes(&bits, sizeof(bits));
+    }
+    void add(const std::string& s) {
+        bytes(s.data(), s.size());
+        add(static_cast<double>(s.size()));
+    }
+    void add(const std::vector<double>& v) {
+        add(static_cast<double>(v.size()));
+        for (double x : v) add(x);
+    }
+};
+
+bool sameArrhenius(double A1, double b1, double Ea1, double A2, double b2, double Ea2) {
+    return A1 == A2 && b1 == b2 && Ea1 == Ea2;
+}
+
+typedef std::unordered_map<std::string, size_t> NameIndex;
+
+// 第三体效率是否一致: 两边都有的组分效率相同, 只在一边出现的组分不在另一个机理中
+// (简化或子集机理去掉了未声明组分的效率, 与完整机理的同一反应不算冲突)
+bool compatibleEfficiencies(const std::map<std::string, double>& a, const NameIndex& aSpecies,
+    const std::map<std::string, double>& b, const NameIndex& bSpecies) {
+    for (const auto& pair : a) {
+        auto it = b.find(pair.first);
+        if (it != b.end() ? it->second != pair.second : bSpecies.count(pair.first) > 0) return false;
+    }
+    for (const auto& pair : b) {
+        if (!a.count(pair.first) && aSpecies.count(pair.first)) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+uint64_t MechanismMerge::thermoFingerprint(const ChemistryVars::ThermoData& thermo) {
+    Hasher h;
+    for (const auto& elem : thermo.composition) {
+        h.add(elem.first);
+        h.add(elem.second);
+    }
+    h.add(thermo.model);
+    h.add(thermo.temperatureRanges);
+    h.add(thermo.coefficients.low);
+    h.add(thermo.coefficients.high);
+    for (const auto& range : thermo.nasa9Coeffs) {
+        h.add(range.temperatureRange);
+        h.add(range.coefficients);
+    }
+    return h.h;
+}
+
+bool MechanismMerge::sameThermo(const ChemistryVars::ThermoData& a, const ChemistryVars::ThermoData& b) {
+    if (a.composition != b.composition || a.model != b.model ||
+        a.temperatureRanges != b.temperatureRanges ||
+        a.coefficients.low != b.coefficients.low ||
+        a.coefficients.high != b.coefficients.high ||
+        a.nasa9Coeffs.size() != b.nasa9Coeffs.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.nasa9Coeffs.size(); ++i) {
+        if (a.nasa9Coeffs[i].temperatureRange != b.nasa9Coeffs[i].temperatureRange ||
+            a.nasa9Coeffs[i].coefficients != b.nasa9Coeffs[i].coefficients) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool MechanismMerge::sameTransport(const ChemistryVars::TransportData& a, const ChemistryVars::TransportData& b) {
+    return a.model == b.model && a.geometry == b.geometry &&
+        a.diameter == b.diameter && a.wellDepth == b.wellDepth &&
+        a.dipole == b.dipole && a.polarizability == b.polarizability &&
+        a.rotationalRelaxation == b.rotationalRelaxation;
+}
+
+bool MechanismMerge::sameRate(const ChemistryVars::ReactionData& a, const ChemistryVars::ReactionData& b) {
+    return sameRate(a, b, true);
+}
+
+bool MechanismMerge::sameRate(const ChemistryVars::ReactionData& a, const ChemistryVars::ReactionData& b,
+    bool compareEfficiencies) {
+    const auto& ra = a.rateConstant;
+    const auto& rb = b.rateConstant;
+    if (a.type != b.type ||
+        !sameArrhenius(ra.A, ra.b, ra.Ea, rb.A, rb.b, rb.Ea) ||
+        !sameArrhenius(a.lowPressure.A, a.lowPressure.b, a.lowPressure.Ea,
+            b.lowPressure.A, b.lowPressure.b, b.lowPressure.Ea) ||
+        a.troe.a != b.troe.a || a.troe.T_star != b.troe.T_star ||
+        a.troe.T_double_star != b.troe.T_double_star ||
+        a.troe.T_triple_star != b.troe.T_triple_star ||
+        (compareEfficiencies && a.efficiencies != b.efficiencies) || a.orders != b.orders ||
+        ra.plogData.size() != rb.plogData.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < ra.plogData.size(); ++i) {
+        const auto& pa = ra.plogData[i];
+        const auto& pb = rb.plogData[i];
+        if (pa.pressure != pb.pressure || !sameArrhenius(pa.A, pa.b, pa.Ea, pb.A, pb.b, pb.Ea)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+MechanismMerge::Result MechanismMerge::merge(const ChemistryVars::MechanismData& base,
+    const ChemistryVars::MechanismData& addition) {
+    return merge(base, addition, Options());
+}
+
+MechanismMerge::Result MechanismMerge::merge(const std::vector<const ChemistryVars::MechanismData*>& parts) {
+    return merge(parts, Options());
+}
+
+MechanismMerge::Result MechanismMerge::merge(const ChemistryVars::MechanismData& base,
+    const ChemistryVars::MechanismData& addition, const Options& options) {
+    Result result;
+    ChemistryVars::MechanismData& merged = result.mechanism;
+    merged = base;
+
+    // 组分: 按名称连接, 指纹用于发现热力学不一致和别名
+    std::unordered_map<std::string, size_t> speciesByName;
+    std::unordered_multimap<uint64_t, size_t> speciesByPrint;
+    speciesByName.reserve(base.thermoSpecies.size() + addition.thermoSpecies.size());
+    speciesByPrint.reserve(base.thermoSpecies.size() + addition.thermoSpecies.size());
+    for (size_t k = 0; k < base.thermoSpecies.size(); ++k) {
+        speciesByName.emplace(base.thermoSpecies[k].name, k);
+        speciesByPrint.emplace(thermoFingerprint(base.thermoSpecies[k]), k);
+    }
+
+    for (size_t k = 0; k < addition.thermoSpecies.size(); ++k) {
+        const auto& thermo = addition.thermoSpecies[k];
+        uint64_t print = thermoFingerprint(thermo);
+
+        auto it = speciesByName.find(thermo.name);
+        if (it != speciesByName.end()) {
+            const auto& existing = merged.thermoSpecies[it->second];
+            if (thermoFingerprint(existing) != print || !sameThermo(existing, thermo)) {
+                result.conflicts.push_back({ Conflict::Kind::ThermoMismatch, thermo.name, it->second, k });
+            }
+            result.speciesShared++;
+            continue;
+        }
+
+        auto range = speciesByPrint.equal_range(print);
+        for (auto p = range.first; p != range.second; ++p) {
+            if (sameThermo(merged.thermoSpecies[p->second], thermo)) {
+                result.conflicts.push_back({ Conflict::Kind::SpeciesAlias, thermo.name, p->second, k });
+                break;
+            }
+        }
+
+        size_t index = merged.thermoSpecies.size();
+        merged.thermoSpecies.push_back(thermo);
+        speciesByName.emplace(thermo.name, index);
+        speciesByPrint.emplace(print, index);
+        result.speciesAdded++;
+    }
+
+    // 输运数据: 按名称连接
+    std::unordered_map<std::string, size_t> transportByName;
+    transportByName.reserve(base.transportSpecies.size() + addition.transportSpecies.size());
+    for (size_t t = 0; t < base.transportSpecies.size(); ++t) {
+        transportByName.emplace(base.transportSpecies[t].name, t);
+    }
+    for (size_t t = 0; t < addition.transportSpecies.size(); ++t) {
+        const auto& transport = addition.transportSpecies[t];
+        auto it = transportByName.find(transport.name);
+        if (it != transportByName.end()) {
+            if (!sameTransport(merged.transportSpecies[it->second], transport)) {
+                result.conflicts.push_back({ Conflict::Kind::TransportMismatch, transport.name, it->second, t });
+            }
+            continue;
+        }
+        transportByName.emplace(transport.name, merged.transportSpecies.size());
+        merged.transportSpecies.push_back(transport);
+    }
+
+    // 反应: 按规范化化学计量式哈希连接, 只与基础机理中的反应比较
+    // (附加机理内部已声明的重复反应保持原样); 与checkDuplicates相同, 方向相反的两个不可逆反应不算重复
+    ReactionIndex baseIndex(base.reactions);
+    NameIndex baseSpecies, additionSpecies;
+    for (size_t k = 0; k < base.thermoSpecies.size(); ++k) baseSpecies.emplace(base.thermoSpecies[k].name, k);
+    for (size_t k = 0; k < addition.thermoSpecies.size(); ++k) {
+        additionSpecies.emplace(addition.thermoSpecies[k].name, k);
+    }
+    std::vector<size_t> matches;
+    for (size_t i = 0; i < addition.reactions.size(); ++i) {
+        const auto& reaction = addition.reactions[i];
+        ReactionIndex::Stoichiometry stoich = ReactionIndex::parseEquation(reaction.equation);
+        std::string key = ReactionIndex::canonicalKey(stoich);
+        matches.clear();
+        for (size_t j : baseIndex.findKey(key)) {
+            if (!ReactionIndex::distinctDirections(baseIndex.stoichiometry(j), stoich)) {
+                matches.push_back(j);
+            }
+        }
+
+        if (matches.empty()) {
+            merged.reactions.push_back(reaction);
+            result.reactionsAdded++;
+            continue;
+        }
+
+        // 速率相同 (效率只差未声明组分) 时为同一反应, 合并后的反应取两边效率的并集
+        bool identical = false;
+        for (size_t j : matches) {
+            const auto& existing = base.reactions[j];
+            if (sameRate(existing, reaction, false) &&
+                compatibleEfficiencies(existing.efficiencies, baseSpecies, reaction.efficiencies, additionSpecies)) {
+                merged.reactions[j].efficiencies.insert(reaction.efficiencies.begin(), reaction.efficiencies.end());
+                identical = true;
+                break;
+            }
+        }
+        if (identical) {
+            result.reactionsShared++;
+            continue;
+        }
+
+        result.conflicts.push_back({ Conflict::Kind::DuplicateReaction, key, matches.front(), i });
+        if (options.keepConflictingReactions) {
+            for (size_t j : matches) merged.reactions[j].isDuplicate = true;
+            merged.reactions.push_back(reaction);
+            merged.reactions.back().isDuplicate = true;
+            result.reactionsAdded++;
+        }
+    }
+
+    return result;
+}
+
+MechanismMerge::Result MechanismMerge::merge(const std::vector<const ChemistryVars::MechanismData*>& parts,
+    const Options& options) {
+    if (parts.empty() || !parts.front()) {
+        throw std::invalid_argument("MechanismMerge: no base mechanism");
+    }
+
+    Result result;
+    result.mechanism = *parts.front();
+    for (size_t p = 1; p < parts.size(); ++p) {
+        if (!parts[p]) continue;
+        Result step = merge(result.mechanism, *parts[p], options);
+        result.mechanism = std::move(step.mechanism);
+        result.conflicts.insert(result.conflicts.end(), step.conflicts.begin(), step.conflicts.end());
+        result.speciesAdded += step.speciesAdded;
+        result.speciesShared += step.speciesShared;
+        result.reactionsAdded += step.reactionsAdded;
+        result.reactionsShared += step.reactionsShared;
+    }
+    return result;
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include "ChemistryVars.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// 机理合并 - 组分按名称和热力学指纹连接, 反应按规范化化学计量式哈希连接
+// 所有查找均基于哈希表, 总耗时与两个机理的规模成线性关系
+class MechanismMerge {
+public:
+    // 合并冲突
+    struct Conflict {
+        enum class Kind {
+            ThermoMismatch,         // 同名组分的热力学数据不同 (保留基础机理的数据)
+            TransportMismatch,      // 同名组分的输运数据不同 (保留基础机理的数据)
+            SpeciesAlias,           // 不同名称的组分具有完全相同的热力学数据
+            DuplicateReaction       // 化学计量相同但速率参数不同的反应
+        };
+        Kind kind;
+        std::string name;           // 组分名或规范化方程式
+        size_t baseIndex;           // 在基础机理中的索引
+        size_t otherIndex;          // 在附加机理中的索引
+    };
+
+    // 合并选项
+    struct Options {
+        // 速率参数不同的重复反应: false时保留基础机理的反应, true时两个都保留并标记为duplicate
+        bool keepConflictingReactions = false;
+    };
+
+    // 合并结果
+    struct Result {
+        ChemistryVars::MechanismData mechanism;
+        std::vector<Conflict> conflicts;
+        size_t speciesAdded = 0;
+        size_t speciesShared = 0;
+        size_t reactionsAdded = 0;
+        size_t reactionsShared = 0;     // 与基础机理完全相同而跳过的反应
+    };
+
+    static Result merge(const ChemistryVars::MechanismData& base,
+        const ChemistryVars::MechanismData& addition);
+    static Result merge(const ChemistryVars::MechanismData& base,
+        const ChemistryVars::MechanismData& addition,
+        const Options& options);
+
+    // 依次合并多个机理 (第一个为基础机理)
+    static Result merge(const std::vector<const ChemistryVars::MechanismData*>& parts);
+    static Result merge(const std::vector<const ChemistryVars::MechanismData*>& parts,
+        const Options& options);
+
+    // 热力学数据指纹 (组成、模型、温度范围和全部系数)
+    static uint64_t thermoFingerprint(const ChemistryVars::ThermoData& thermo);
+
+    // 数据比较
+    static bool sameThermo(const ChemistryVars::ThermoData& a, const ChemistryVars::ThermoData& b);
+    static bool sameTransport(const ChemistryVars::TransportData& a, const ChemistryVars::TransportData& b);
+    static bool sameRate(const ChemistryVars::ReactionData& a, const ChemistryVars::ReactionData& b);
+    // compareEfficiencies为false时不比较第三体效率 (由调用者另行判断)
+    static bool sameRate(const ChemistryVars::ReactionData& a, const ChemistryVars::ReactionData& b,
+        bool compareEfficiencies);
+};
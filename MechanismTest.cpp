@@ -1,11 +1,30 @@
 #include "ChemistryVars.h"
+#include "ReactionIndex.h"
+#include "MechanismView.h"
+#include "MechanismMerge.h"
+#include "DRGReduction.h"
+#include "ElementTable.h"
+#include "CompactReactions.h"
+#include "MechanismAnalytics.h"
+#include "ReactionGraph.h"
+#include "ThermoKernels.h"
+#include "IdealGasPhase.h"
+#include "ThermoBatch.h"
+#include "GasEquilibrium.h"
+#include "EquilibriumTable.h"
+#include "ThermoPrecision.h"
+#include "ThermoCodegen.h"
 #include <iostream>
 #include <iomanip>
 #include <string>
 #include <vector>
 #include <map>
+#include <set>
 #include <algorithm>
 #include <limits>
+#include <cmath>
+#include <cstdio>
+#include <thread>
 
 // Test results structure
 struct TestResults {
@@ -286,15 +305,16 @@ void testReactions(ChemistryVars::MechanismData& mechanism, TestResults& results
         }
     };
 
-    // Create a copy of reactions list so we can remove matched reactions
-    std::vector<ChemistryVars::ReactionData> availableReactions = mechanism.reactions;
+    // Index reactions by canonical stoichiometry; matched reactions are marked as used
+    ReactionIndex index(mechanism.reactions);
+    std::vector<bool> used(mechanism.reactions.size(), false);
 
     // Test each expected reaction
     for (const auto& expected : expectedReactions) {
-        // Find all reactions with matching equation
+        // Find all unused reactions with matching equation
         std::vector<size_t> matchingIndices;
-        for (size_t i = 0; i < availableReactions.size(); i++) {
-            if (availableReactions[i].equation == expected.equation) {
+        for (size_t i : index.find(expected.equation)) {
+            if (!used[i]) {
                 matchingIndices.push_back(i);
             }
         }
@@ -311,7 +331,7 @@ void testReactions(ChemistryVars::MechanismData& mechanism, TestResults& results
         double bestMatchScore = std::numeric_limits<double>::max();
 
         for (size_t idx : matchingIndices) {
-            const auto& rxn = availableReactions[idx];
+            const auto& rxn = mechanism.reactions[idx];
 
             // Calculate a score based on differences (lower is better match)
             double scoreA = std::abs(rxn.rateConstant.A - expected.A) / (expected.A > 1.0 ? expected.A : 1.0);
@@ -328,7 +348,8 @@ void testReactions(ChemistryVars::MechanismData& mechanism, TestResults& results
         }
 
         // Use the best match for testing
-        const ChemistryVars::ReactionData& actual = availableReactions[bestMatchIndex];
+        const ChemistryVars::ReactionData& actual = mechanism.reactions[bestMatchIndex];
+        used[bestMatchIndex] = true;
         bool reactionPassed = true;
         results.totalTests++;
 
@@ -418,9 +439,1694 @@ void testReactions(ChemistryVars::MechanismData& mechanism, TestResults& results
             results.passedTests++;
             std::cout << " Reaction " << expected.equation << " test passed" << std::endl;
         }
+    }
+}
+
+// Test duplicate flags against canonical stoichiometry
+void testDuplicates(ChemistryVars::MechanismData& mechanism, TestResults& results) {
+    std::cout << "\n===== Duplicate Reaction Tests =====\n";
+
+    ReactionIndex index(mechanism.reactions);
+    std::vector<ReactionIndex::DuplicateIssue> issues = index.checkDuplicates();
+
+    results.totalTests++;
+    if (issues.empty()) {
+        results.passedTests++;
+        std::cout << " Duplicate flags consistent for " << index.nReactions() << " reactions" << std::endl;
+        return;
+    }
+
+    for (const auto& issue : issues) {
+        const std::string& equation = mechanism.reactions[issue.reaction].equation;
+        if (issue.kind == ReactionIndex::DuplicateIssue::Kind::Undeclared) {
+            results.failureMessages.push_back(equation + ": Undeclared duplicate reaction");
+            std::cout << " Reaction #" << (issue.reaction + 1) << " " << equation
+                << " duplicates reaction #" << (issue.other + 1) << " but is not marked duplicate" << std::endl;
+        }
+        else {
+            results.failureMessages.push_back(equation + ": Duplicate flag without matching reaction");
+            std::cout << " Reaction #" << (issue.reaction + 1) << " " << equation
+                << " is marked duplicate but has no matching reaction" << std::endl;
+        }
+    }
+}
+
+// Test element table, molecular weights and element conservation of every reaction
+void testElements(ChemistryVars::MechanismData& mechanism, TestResults& results) {
+    std::cout << "\n===== Element Table Tests =====\n";
+
+    ElementTable elements(mechanism.thermoSpecies);
+    std::vector<double> mw = elements.molecularWeights();
+    std::map<std::string, size_t> speciesIndex;
+    for (size_t k = 0; k < mechanism.thermoSpecies.size(); k++) {
+        speciesIndex[mechanism.thermoSpecies[k].name] = k;
+    }
+
+    results.totalTests++;
+    bool passed = true;
+    auto h2o = speciesIndex.find("H2O");
+    if (h2o != speciesIndex.end() && !isEqual(mw[h2o->second], 18.015, 1e-3)) {
+        passed = false;
+        std::cout << " H2O molecular weight " << mw[h2o->second] << " != 18.015" << std::endl;
+    }
+
+    std::vector<double> moles(mechanism.thermoSpecies.size());
+    std::vector<double> balance(elements.nElements());
+    for (const auto& reaction : mechanism.reactions) {
+        std::fill(moles.begin(), moles.end(), 0.0);
+        ReactionIndex::Stoichiometry st = ReactionIndex::parseEquation(reaction.equation);
+        bool known = true;
+        for (const auto& sp : st.reactants) {
+            auto it = speciesIndex.find(sp.first);
+            if (it == speciesIndex.end()) known = false;
+            else moles[it->second] -= sp.second;
+        }
+        for (const auto& sp : st.products) {
+            auto it = speciesIndex.find(sp.first);
+            if (it == speciesIndex.end()) known = false;
+            else moles[it->second] += sp.second;
+        }
+        if (!known) continue;
+
+        elements.getElementMoles(moles.data(), balance.data());
+        for (size_t m = 0; m < balance.size(); m++) {
+            if (std::abs(balance[m]) > 1e-10) {
+                passed = false;
+                results.failureMessages.push_back(reaction.equation + ": Element " +
+                    elements.elementName(m) + " not conserved");
+            }
+        }
+    }
+
+    if (passed) {
+        results.passedTests++;
+        std::cout << " " << elements.nElements() << " elements, all reactions conserve elements" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Element table mismatch");
+    }
+}
+
+// Test compact reaction storage round trip
+void testCompact(ChemistryVars::MechanismData& mechanism, TestResults& results) {
+    std::cout << "\n===== Compact Reaction Storage Tests =====\n";
+
+    CompactReactions compact(mechanism.reactions);
+
+    results.totalTests++;
+    bool passed = compact.size() == mechanism.reactions.size();
+    for (size_t i = 0; passed && i < compact.size(); i++) {
+        ChemistryVars::ReactionData expanded = compact.expand(i);
+        const ChemistryVars::ReactionData& original = mechanism.reactions[i];
+        if (expanded.equation != original.equation || expanded.isDuplicate != original.isDuplicate ||
+            expanded.rateConstant.A_units != original.rateConstant.A_units ||
+            expanded.rateConstant.Ea_units != original.rateConstant.Ea_units ||
+            !MechanismMerge::sameRate(expanded, original)) {
+            passed = false;
+            std::cout << " " << original.equation << ": Compact round trip mismatch" << std::endl;
+        }
+    }
+
+    // An explicit "elementary" type survives the round trip, an omitted type stays empty
+    if (!mechanism.reactions.empty()) {
+        ChemistryVars::ReactionData implicitType = mechanism.reactions.front();
+        implicitType.type = "";
+        ChemistryVars::ReactionData explicitType = implicitType;
+        explicitType.type = "elementary";
+        CompactReactions typed(std::vector<ChemistryVars::ReactionData>{ implicitType, explicitType });
+        passed = passed && typed.type(1) == CompactReactions::Type::Elementary &&
+            typed.expand(0).type.empty() && typed.expand(1).type == "elementary";
+    }
+
+    if (passed) {
+        results.passedTests++;
+        std::cout << " " << compact.memoryUsage() << " bytes compact vs "
+            << CompactReactions::memoryUsage(mechanism.reactions) << " bytes as ReactionData" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Compact reaction storage mismatch");
+    }
+}
+
+// Test single-pass mechanism analytics
+void testAnalytics(ChemistryVars::MechanismData& mechanism, TestResults& results) {
+    std::cout << "\n===== Mechanism Analytics Tests =====\n";
+
+    MechanismAnalytics::Report report = MechanismAnalytics::analyze(mechanism);
+
+    size_t typed = 0;
+    for (const auto& entry : report.typeHistogram) typed += entry.second;
+
+    results.totalTests++;
+    if (typed == mechanism.reactions.size() && report.species.size() == mechanism.thermoSpecies.size() &&
+        report.imbalances.empty() && report.A.count == mechanism.reactions.size() &&
+        report.toJson().find("\"speciesUsage\"") != std::string::npos) {
+        results.passedTests++;
+        std::cout << " " << report.typeHistogram.size() << " reaction types, "
+            << report.unreferencedSpecies.size() << " unreferenced species, Ea range ["
+            << report.Ea.min << ", " << report.Ea.max << "]" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Mechanism analytics mismatch");
+        std::cout << " Mechanism analytics mismatch: " << report.imbalances.size() << " imbalances" << std::endl;
+    }
+}
+
+// Test species-reaction graph and element flux conservation
+void testReactionPaths(ChemistryVars::MechanismData& mechanism, TestResults& results) {
+    std::cout << "\n===== Reaction Path Tests =====\n";
+
+    ReactionGraph graph(mechanism);
+    std::vector<double> rates(graph.nReactions());
+    for (size_t i = 0; i < rates.size(); i++) {
+        rates[i] = (i % 3 == 0 ? -1.0 : 1.0) * (1.0 + 0.1 * i);
+    }
+    std::vector<double> wdot(graph.nSpecies());
+    graph.getNetProductionRates(rates.data(), wdot.data());
+
+    // Atoms leaving a species along path edges must equal its net consumption of that element
+    results.totalTests++;
+    bool passed = true;
+    size_t nEdges = 0;
+    for (const auto& element : graph.elements().elementNames()) {
+        ElementFlux paths(graph, element);
+        std::vector<double> flux = paths.compute(rates);
+        nEdges += paths.nEdges();
+
+        size_t m = graph.elements().elementIndex(element);
+        std::vector<double> outMinusIn(graph.nSpecies(), 0.0);
+        for (size_t e = 0; e < paths.nEdges(); e++) {
+            outMinusIn[paths.edgeSource(e)] += flux[e];
+            outMinusIn[paths.edgeTarget(e)] -= flux[e];
+        }
+        for (size_t k = 0; k < graph.nSpecies(); k++) {
+            double expected = -graph.elements().nAtoms(k, m) * wdot[k];
+            if (!isEqual(outMinusIn[k], expected, 1e-9 * (1.0 + std::abs(expected)))) {
+                passed = false;
+                std::cout << " " << element << " flux not conserved for " << mechanism.thermoSpecies[k].name
+                    << ": " << outMinusIn[k] << " vs " << expected << std::endl;
+            }
+        }
+    }
+
+    if (passed) {
+        results.passedTests++;
+        std::cout << " Element fluxes conserved over " << nEdges << " path edges" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Element flux conservation mismatch");
+    }
+}
+
+// Test that every supported SIMD thermo kernel matches the scalar kernel
+void testThermoKernels(ChemistryVars::MechanismData& mechanism, TestResults& results) {
+    std::cout << "\n===== Thermo Kernel Tests =====\n";
+
+    Nasa7Table table(mechanism.thermoSpecies);
+    size_t n = table.nSpecies();
+    std::vector<double> h0(n), s0(n), cp0(n), h(n), s(n), cp(n);
+
+    results.totalTests++;
+    bool passed = true;
+    const ThermoKernels::Isa isas[] = { ThermoKernels::Isa::AVX2, ThermoKernels::Isa::AVX512 };
+    for (ThermoKernels::Isa isa : isas) {
+        if (!ThermoKernels::isSupported(isa)) continue;
+        for (double T = 250.0; T <= 3500.0; T += 125.0) {
+            ThermoKernels::evaluate(ThermoKernels::Isa::Scalar, table, T, h0.data(), s0.data(), cp0.data());
+            ThermoKernels::evaluate(isa, table, T, h.data(), s.data(), cp.data());
+            if (!compareVectors(h, h0, 1e-10) || !compareVectors(s, s0, 1e-10) || !compareVectors(cp, cp0, 1e-10)) {
+                passed = false;
+                std::cout << " " << ThermoKernels::isaName(isa) << " kernel mismatch at T = " << T << std::endl;
+                break;
+            }
+        }
+    }
+
+    if (passed) {
+        results.passedTests++;
+        std::cout << " Kernels agree, active ISA: " << ThermoKernels::isaName(ThermoKernels::activeIsa()) << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Thermo kernel mismatch");
+    }
+
+    // Pre-scaled coefficients must reproduce the textbook NASA7 expressions
+    results.totalTests++;
+    passed = true;
+    for (size_t k = 0; k < n && passed; ++k) {
+        const auto& thermo = mechanism.thermoSpecies[k];
+        if (!table.hasNasa7(k)) continue;
+        for (double T = 300.0; T <= 3000.0; T += 450.0) {
+            bool high = thermo.coefficients.high.size() >= 7 && thermo.temperatureRanges.size() >= 3 &&
+                T > thermo.temperatureRanges[1];
+            const std::vector<double>& a = high ? thermo.coefficients.high : thermo.coefficients.low;
+            double hRef = a[0] + a[1] * T / 2.0 + a[2] * T * T / 3.0 + a[3] * T * T * T / 4.0 +
+                a[4] * T * T * T * T / 5.0 + a[5] / T;
+            double sRef = a[0] * std::log(T) + a[1] * T + a[2] * T * T / 2.0 + a[3] * T * T * T / 3.0 +
+                a[4] * T * T * T * T / 4.0 + a[6];
+            double hk, sk, cpk;
+            table.evaluate(k, T, hk, sk, cpk);
+            if (std::abs(hk - hRef) > 1e-9 * std::max(1.0, std::abs(hRef)) ||
+                std::abs(sk - sRef) > 1e-9 * std::max(1.0, std::abs(sRef))) {
+                passed = false;
+                std::cout << " Pre-scaled NASA7 mismatch for " << thermo.name << " at T = " << T << std::endl;
+                break;
+            }
+        }
+    }
+
+    if (passed) {
+        results.passedTests++;
+        std::cout << " Pre-scaled coefficients match NASA7 expressions" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Pre-scaled NASA7 coefficient mismatch");
+    }
+
+    // A database species without NASA7 data gets the same defaults as one added by addSpecies:
+    // h/RT = s/R = 0, cp/R = 3.5, in every kernel, the single-precision table, the batch and the codegen
+    results.totalTests++;
+    std::vector<ChemistryVars::ThermoData> species = mechanism.thermoSpecies;
+    species.push_back(species[0]);
+    species.back().name = "NODATA";
+    species.back().coefficients.low.clear();
+    species.back().coefficients.high.clear();
+    auto db = std::make_shared<const SpeciesThermo>(species);
+    ThermoWorkspace work;
+    work.resize(n + 2);                 // the last entry has no database record at all
+    passed = true;
+    ThermoKernels::Isa saved = ThermoKernels::activeIsa();
+    const ThermoKernels::Isa allIsas[] = { ThermoKernels::Isa::Scalar, ThermoKernels::Isa::AVX2, ThermoKernels::Isa::AVX512 };
+    for (ThermoKernels::Isa isa : allIsas) {
+        if (!ThermoKernels::isSupported(isa)) continue;
+        ThermoKernels::setIsa(isa);
+        work.invalidate();
+        db->update(1500.0, work);
+        ThermoEvaluatorF32 single(db);
+        single.update(1500.0);
+        for (size_t k = n; k < n + 2; k++) {
+            passed = passed && work.h_RT[k] == 0.0 && work.s_R[k] == 0.0 && work.cp_R[k] == 3.5;
+        }
+        passed = passed && single.h_RT()[n] == 0.0f && single.s_R()[n] == 0.0f && single.cp_R()[n] == 3.5f;
+    }
+    ThermoKernels::setIsa(saved);
+    double hk, sk, cpk;
+    db->nasa7().evaluate(n, 1500.0, hk, sk, cpk);
+    passed = passed && hk == 0.0 && sk == 0.0 && cpk == 3.5;
+
+    IdealGasPhase gas(db);
+    ThermoBatch batch(gas);
+    std::vector<double> Y(2 * (n + 1), 0.0), T(2, 1500.0), hMass(2), Tinv(2);
+    Y[0] = 1.0;                         // pure species 0
+    Y[n + 1] = 0.5;                     // half species 0, half NODATA
+    Y[2 * n + 1] = 0.5;
+    ThermoBatch::States states;
+    states.n = 2;
+    states.T = T.data();
+    states.Y = Y.data();
+    states.stateStride = n + 1;
+    ThermoBatch::Properties props;
+    props.enthalpy_mass = hMass.data();
+    batch.evaluate(states, props, 1);
+    states.T = nullptr;
+    batch.invertEnthalpy(states, hMass.data(), 1, Tinv.data(), 1, 1);
+    passed = passed && isEqual(hMass[1], 0.5 * hMass[0], 1e-9 * std::abs(hMass[0])) && isEqual(Tinv[1], 1500.0, 1e-6);
+
+    std::string header = ThermoCodegen::generateHeader(species);
+    passed = passed && header.find("h_RT[" + std::to_string(n) + "] = 0.0;") != std::string::npos &&
+        header.find("s_R[" + std::to_string(n) + "] = 0.0;") != std::string::npos;
+    if (passed) {
+        results.passedTests++;
+        std::cout << " Species without NASA7 data use h/RT = s/R = 0, cp/R = 3.5" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Species without thermo data have inconsistent defaults");
+    }
+}
+
+// Convert a two-range NASA7 species into an equivalent three-range NASA9 species
+ChemistryVars::ThermoData toNasa9(const ChemistryVars::ThermoData& thermo) {
+    ChemistryVars::ThermoData result = thermo;
+    double Tlow = thermo.temperatureRanges[0], Tmid = thermo.temperatureRanges[1];
+    double Thigh = thermo.temperatureRanges[2], Tsplit = 0.5 * (Tlow + Tmid);
+    const std::vector<double>* sets[] = { &thermo.coefficients.low, &thermo.coefficients.low, &thermo.coefficients.high };
+    const double bounds[] = { Tlow, Tsplit, Tmid, Thigh };
+
+    result.model = "NASA9";
+    result.temperatureRanges.assign(bounds, bounds + 4);
+    result.coefficients.low.clear();
+    result.coefficients.high.clear();
+    for (int r = 0; r < 3; r++) {
+        const std::vector<double>& a = *sets[r];
+        ChemistryVars::ThermoData::NASA9Range range;
+        range.temperatureRange = { bounds[r], bounds[r + 1] };
+        range.coefficients = { 0.0, 0.0, a[0], a[1], a[2], a[3], a[4], a[5], a[6] };
+        result.nasa9Coeffs.push_back(range);
+    }
+    return result;
+}
+
+// Test NASA9 multi-range evaluation and mixed NASA7/NASA9 mechanisms
+void testNasa9(ChemistryVars::MechanismData& mechanism, TestResults& results) {
+    std::cout << "\n===== NASA9 Thermo Tests =====\n";
+
+    // Every other species converted to NASA9 must give the same mixture properties
+    ChemistryVars::MechanismData mixed = mechanism;
+    size_t nConverted = 0;
+    for (size_t k = 0; k < mixed.thermoSpecies.size(); k += 2) {
+        const auto& thermo = mixed.thermoSpecies[k];
+        if (thermo.coefficients.low.size() != 7 || thermo.coefficients.high.size() != 7 ||
+            thermo.temperatureRanges.size() != 3) continue;
+        mixed.thermoSpecies[k] = toNasa9(thermo);
+        nConverted++;
+    }
+
+    IdealGasPhase reference{ MechanismView(MechanismView::Source::copyOf(mechanism)) };
+    IdealGasPhase gas{ MechanismView(MechanismView::Source::copyOf(mixed)) };
+    std::vector<double> x(gas.nSpecies(), 1.0 / gas.nSpecies());
+
+    results.totalTests++;
+    bool passed = nConverted > 0;
+    for (double T = 300.0; T <= 3000.0 && passed; T += 300.0) {
+        reference.setState_TPX(T, OneAtm, x.data());
+        gas.setState_TPX(T, OneAtm, x.data());
+        double scale = 1e-10 * (std::abs(reference.enthalpy_mole()) + reference.entropy_mole() * T);
+        if (!isEqual(gas.cp_mole(), reference.cp_mole(), 1e-10 * reference.cp_mole()) ||
+            !isEqual(gas.enthalpy_mole(), reference.enthalpy_mole(), scale) ||
+            !isEqual(gas.entropy_mole(), reference.entropy_mole(), 1e-10 * reference.entropy_mole())) {
+            passed = false;
+            std::cout << " Mixed NASA7/NASA9 mismatch at T = " << T << std::endl;
+        }
+    }
+
+    // SIMD kernels must agree with the scalar path, including the 1/T^2 and ln(T)/T terms
+    std::vector<ChemistryVars::ThermoData> species;
+    for (const auto& thermo : mixed.thermoSpecies) {
+        if (thermo.nasa9Coeffs.empty()) continue;
+        species.push_back(thermo);
+        for (auto& range : species.back().nasa9Coeffs) {
+            range.coefficients[0] = 1.0e4;
+            range.coefficients[1] = -50.0;
+        }
+    }
+    Nasa9Table table(species);
+    size_t n = table.nSpecies();
+    std::vector<double> h(n), s(n), cp(n);
+    const ThermoKernels::Isa isas[] = { ThermoKernels::Isa::Scalar, ThermoKernels::Isa::AVX2, ThermoKernels::Isa::AVX512 };
+    for (ThermoKernels::Isa isa : isas) {
+        if (!ThermoKernels::isSupported(isa) || !passed) continue;
+        for (double T = 250.0; T <= 3500.0; T += 125.0) {
+            ThermoKernels::evaluate(isa, table, T, h.data(), s.data(), cp.data());
+            for (size_t j = 0; j < n; j++) {
+                double hj, sj, cpj;
+                table.evaluate(j, T, hj, sj, cpj);
+                if (!isEqual(h[j], hj, 1e-10) || !isEqual(s[j], sj, 1e-10) || !isEqual(cp[j], cpj, 1e-10)) {
+                    passed = false;
+                }
+            }
+            if (!passed) {
+                std::cout << " " << ThermoKernels::isaName(isa) << " NASA9 kernel mismatch at T = " << T << std::endl;
+                break;
+            }
+        }
+    }
+
+    // Standard-format NASA9 data must survive a YAML round trip with all ranges
+    const std::string file = "nasa9_roundtrip.yaml";
+    ChemistryVars::writeMechanism(mixed, file);
+    std::vector<ChemistryVars::ThermoData> reread = ChemistryVars::extractThermo(file);
+    std::remove(file.c_str());
+    for (size_t k = 0; k < mixed.thermoSpecies.size() && passed; k++) {
+        if (k >= reread.size() || reread[k].nasa9Coeffs.size() != mixed.thermoSpecies[k].nasa9Coeffs.size() ||
+            (!reread[k].nasa9Coeffs.empty() && !reread[k].coefficients.low.empty())) {
+            passed = false;
+            std::cout << " NASA9 round trip mismatch for species #" << k << std::endl;
+        }
+    }
+
+    if (passed) {
+        results.passedTests++;
+        std::cout << " " << nConverted << " species as 3-range NASA9 match NASA7 results" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("NASA9 thermo mismatch");
+    }
+}
+
+// Test tabulated reference-state thermo against the exact polynomials
+void testThermoTable(ChemistryVars::MechanismData& mechanism, TestResults& results) {
+    std::cout << "\n===== Tabulated Thermo Tests =====\n";
+
+    auto source = MechanismView::Source::copyOf(mechanism);
+    IdealGasPhase reference{ MechanismView(source) };
+    IdealGasPhase gas{ MechanismView(source) };
+    std::vector<double> x(gas.nSpecies(), 1.0 / gas.nSpecies());
+
+    results.totalTests++;
+    bool passed = true;
+    const ThermoTable::Interpolation modes[] = { ThermoTable::Interpolation::Cubic, ThermoTable::Interpolation::Linear };
+    const double tolerances[] = { 1e-7, 1e-4 };
+    size_t cubicIntervals = 0;
+    for (int m = 0; m < 2; m++) {
+        ThermoTable::Options options;
+        options.interpolation = modes[m];
+        options.relTol = tolerances[m];
+        std::shared_ptr<const ThermoTable> table = gas.enableThermoTable(options);
+        if (m == 0) cubicIntervals = table->nIntervals();
+        if (table->maxError() > options.relTol) passed = false;
+
+        // Off-grid temperatures, polynomial breakpoints, the range ends and one point outside the table
+        const double temps[] = { 300.0, 417.3, 999.99, 1000.0, 1000.01, 1733.7, 2999.9, 3000.0, 3500.0 };
+        for (double T : temps) {
+            reference.setState_TPX(T, OneAtm, x.data());
+            gas.setState_TPX(T, OneAtm, x.data());
+            double tol = 2.0 * options.relTol;
+            double hScale = std::abs(reference.enthalpy_mole()) + reference.entropy_mole() * T;
+            if (!isEqual(gas.cp_mole(), reference.cp_mole(), tol * reference.cp_mole()) ||
+                !isEqual(gas.enthalpy_mole(), reference.enthalpy_mole(), tol * hScale) ||
+                !isEqual(gas.entropy_mole(), reference.entropy_mole(), tol * reference.entropy_mole())) {
+                passed = false;
+                std::cout << " Tabulated thermo mismatch at T = " << T << std::endl;
+            }
+        }
+    }
+    gas.disableThermoTable();
 
-        // Remove the matched reaction from available list to avoid matching it again
-        availableReactions.erase(availableReactions.begin() + bestMatchIndex);
+    if (passed) {
+        results.passedTests++;
+        std::cout << " Cubic table for 1e-7: " << cubicIntervals << " intervals" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Tabulated thermo mismatch");
+    }
+}
+
+// Test batch multi-state evaluation against single-state IdealGasPhase getters
+void testBatch(ChemistryVars::MechanismData& mechanism, TestResults& results) {
+    std::cout << "\n===== Batch Property Tests =====\n";
+
+    IdealGasPhase gas{ MechanismView(MechanismView::Source::copyOf(mechanism)) };
+    ThermoBatch batch(gas);
+    size_t nsp = gas.nSpecies();
+    const size_t n = 1200;
+
+    // Deterministic pseudo-random states, mass fractions stored species-major (SoA)
+    std::vector<double> T(n), P(n), Ysoa(n * nsp), Yaos(n * nsp);
+    unsigned seed = 12345;
+    auto next = [&seed]() { seed = seed * 1103515245u + 12345u; return (seed >> 8) / 16777216.0; };
+    for (size_t i = 0; i < n; i++) {
+        T[i] = 300.0 + 2500.0 * next();
+        P[i] = 1e5 * (1.0 + 50.0 * next());
+        for (size_t k = 0; k < nsp; k++) {
+            double y = next() < 0.3 ? 0.0 : next();
+            Ysoa[k * n + i] = y;
+            Yaos[i * nsp + k] = y;
+        }
+    }
+
+    const int nProps = 7;
+    std::vector<double> soa(nProps * n), aos(nProps * n), threaded(nProps * n);
+    auto bind = [n](std::vector<double>& buf) {
+        ThermoBatch::Properties out;
+        out.meanMolecularWeight = &buf[0];
+        out.cp_mass = &buf[n];
+        out.cv_mass = &buf[2 * n];
+        out.enthalpy_mass = &buf[3 * n];
+        out.intEnergy_mass = &buf[4 * n];
+        out.entropy_mass = &buf[5 * n];
+        out.density = &buf[6 * n];
+        return out;
+    };
+
+    ThermoBatch::States states;
+    states.n = n;
+    states.T = T.data();
+    states.P = P.data();
+    states.Y = Ysoa.data();
+    states.stateStride = 1;
+    states.speciesStride = n;
+    batch.evaluate(states, bind(soa), 1);
+    batch.evaluate(states, bind(threaded), 4);
+
+    states.Y = Yaos.data();
+    states.stateStride = nsp;
+    states.speciesStride = 1;
+    batch.evaluate(states, bind(aos), 1);
+
+    results.totalTests++;
+    bool passed = soa == threaded && soa == aos;
+    std::vector<double> y(nsp);
+    for (size_t i = 0; i < n && passed; i += 37) {
+        std::copy(Yaos.begin() + i * nsp, Yaos.begin() + (i + 1) * nsp, y.begin());
+        gas.setState_TPY(T[i], P[i], y.data());
+        const double expected[nProps] = { gas.meanMolecularWeight(), gas.cp_mass(), gas.cv_mass(),
+            gas.enthalpy_mass(), gas.intEnergy_mass(), gas.entropy_mass(), gas.density() };
+        double scale = std::abs(gas.enthalpy_mass()) + gas.entropy_mass() * T[i];
+        for (int p = 0; p < nProps; p++) {
+            double tol = 1e-10 * (p == 3 || p == 4 ? scale : std::abs(expected[p]));
+            if (!isEqual(soa[p * n + i], expected[p], tol)) {
+                passed = false;
+                std::cout << " Batch property " << p << " mismatch at state " << i << ": "
+                    << soa[p * n + i] << " vs " << expected[p] << std::endl;
+            }
+        }
+    }
+
+    if (passed) {
+        results.passedTests++;
+        std::cout << " " << n << " states agree with single-state getters (SoA, AoS, 4 threads)" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Batch property mismatch");
+    }
+
+    // Without a state stride every state would read state 0's composition: rejected
+    results.totalTests++;
+    states.stateStride = 0;
+    int rejected = 0;
+    try {
+        batch.evaluate(states, bind(aos), 1);
+    }
+    catch (const std::invalid_argument&) {
+        rejected++;
+    }
+    try {
+        batch.invertEnthalpy(states, &aos[3 * n], 1, soa.data(), 1, 1);
+    }
+    catch (const std::invalid_argument&) {
+        rejected++;
+    }
+    if (rejected == 2) {
+        results.passedTests++;
+        std::cout << " Missing state stride rejected" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Batch accepted a zero state stride");
+    }
+}
+
+// Test concurrent evaluation from phases sharing one immutable species-thermo database
+void testSharedThermo(ChemistryVars::MechanismData& mechanism, TestResults& results) {
+    std::cout << "\n===== Shared Thermo Database Tests =====\n";
+
+    IdealGasPhase gas{ MechanismView(MechanismView::Source::copyOf(mechanism)) };
+    std::shared_ptr<const SpeciesThermo> db = gas.speciesThermo();
+    size_t nsp = gas.nSpecies();
+    std::vector<double> X(nsp, 1.0 / nsp);
+
+    // Serial reference: each thread gets its own temperature sequence
+    const size_t nThreads = 4, nStates = 200, nValues = 4;
+    auto temperature = [](size_t t, size_t i) { return 300.0 + 13.7 * i + 1.3 * t; };
+    std::vector<double> expected(nThreads * nStates * nValues);
+    ThermoWorkspace serial;
+    serial.resize(nsp);
+    for (size_t t = 0; t < nThreads; t++) {
+        for (size_t i = 0; i < nStates; i++) {
+            gas.setState_TPX(temperature(t, i), OneAtm, X.data());
+            db->update(temperature(t, i), serial);
+            double* e = &expected[(t * nStates + i) * nValues];
+            e[0] = gas.cp_mole();
+            e[1] = gas.enthalpy_mole();
+            e[2] = gas.entropy_mole();
+            e[3] = serial.g_RT[nsp - 1];
+        }
+    }
+
+    // Per-thread phases (fresh ones on the database and plain copies) plus a bare workspace
+    std::vector<double> actual(expected.size());
+    std::vector<const SpeciesThermo*> shared(nThreads);
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < nThreads; t++) {
+        workers.emplace_back([&, t]() {
+            IdealGasPhase local = t % 2 == 0 ? IdealGasPhase(db) : gas;
+            shared[t] = local.speciesThermo().get();
+            ThermoWorkspace work;
+            work.resize(nsp);
+            for (size_t i = 0; i < nStates; i++) {
+                local.setState_TPX(temperature(t, i), OneAtm, X.data());
+                db->update(temperature(t, i), work);
+                double* a = &actual[(t * nStates + i) * nValues];
+                a[0] = local.cp_mole();
+                a[1] = local.enthalpy_mole();
+                a[2] = local.entropy_mole();
+                a[3] = work.g_RT[nsp - 1];
+            }
+        });
+    }
+    for (auto& worker : workers) worker.join();
+
+    results.totalTests++;
+    bool sameData = std::all_of(shared.begin(), shared.end(),
+        [&db](const SpeciesThermo* p) { return p == db.get(); });
+    if (sameData && actual == expected) {
+        results.passedTests++;
+        std::cout << " " << nThreads << " threads share one database, results identical to serial" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Shared thermo database: concurrent results differ from serial");
+    }
+}
+
+// Test analytic temperature derivatives against central differences
+void testThermoDerivatives(ChemistryVars::MechanismData& mechanism, TestResults& results) {
+    std::cout << "\n===== Thermo Derivative Tests =====\n";
+
+    // Mixed NASA7/NASA9 mechanism; one NASA9 species gets non-zero 1/T^2 and 1/T terms
+    ChemistryVars::MechanismData mixed = mechanism;
+    bool modified = false;
+    for (size_t k = 1; k < mixed.thermoSpecies.size(); k += 2) {
+        const auto& thermo = mixed.thermoSpecies[k];
+        if (thermo.coefficients.low.size() != 7 || thermo.coefficients.high.size() != 7 ||
+            thermo.temperatureRanges.size() != 3) continue;
+        mixed.thermoSpecies[k] = toNasa9(thermo);
+        if (!modified) {
+            for (auto& range : mixed.thermoSpecies[k].nasa9Coeffs) {
+                range.coefficients[0] = 1e4;
+                range.coefficients[1] = -50.0;
+            }
+            modified = true;
+        }
+    }
+
+    IdealGasPhase gas{ MechanismView(MechanismView::Source::copyOf(mixed)) };
+    std::shared_ptr<const SpeciesThermo> db = gas.speciesThermo();
+    size_t nsp = gas.nSpecies();
+    std::vector<double> x(nsp, 1.0 / nsp);
+    const double temperatures[] = { 437.3, 811.9, 1317.7, 1893.1, 2611.3 };
+
+    // Species derivatives for every supported instruction set
+    results.totalTests++;
+    bool passed = true;
+    ThermoKernels::Isa saved = ThermoKernels::activeIsa();
+    const ThermoKernels::Isa isas[] = { ThermoKernels::Isa::Scalar, ThermoKernels::Isa::AVX2, ThermoKernels::Isa::AVX512 };
+    ThermoWorkspace work;
+    std::vector<double> h(nsp), s(nsp), cp(nsp), dcp(nsp), cpPlus(nsp), cpMinus(nsp);
+    double maxErr = 0.0;
+    for (ThermoKernels::Isa isa : isas) {
+        if (!ThermoKernels::isSupported(isa)) continue;
+        ThermoKernels::setIsa(isa);
+        for (double T : temperatures) {
+            const double dT = 1e-3;
+            db->evaluate(T, h.data(), s.data(), cp.data(), dcp.data(), work);
+            db->evaluate(T + dT, h.data(), s.data(), cpPlus.data(), work);
+            db->evaluate(T - dT, h.data(), s.data(), cpMinus.data(), work);
+            for (size_t k = 0; k < nsp; k++) {
+                double fd = (cpPlus[k] - cpMinus[k]) / (2.0 * dT);
+                maxErr = std::max(maxErr, std::abs(dcp[k] - fd));
+            }
+        }
+    }
+    ThermoKernels::setIsa(saved);
+    passed = modified && maxErr < 1e-8;
+
+    // Mixture derivatives
+    for (double T : temperatures) {
+        const double dT = 1e-2;
+        gas.setState_TPX(T + dT, OneAtm, x.data());
+        double cpPlusMix = gas.cp_mole(), sPlus = gas.entropy_mole(), hPlus = gas.enthalpy_mole();
+        gas.setState_TPX(T - dT, OneAtm, x.data());
+        double cpMinusMix = gas.cp_mole(), sMinus = gas.entropy_mole(), hMinus = gas.enthalpy_mole();
+        gas.setState_TPX(T, OneAtm, x.data());
+        double dcpMix = gas.dcp_mole_dT();
+        double tol = 1e-6 * gas.cp_mole();
+        if (!isEqual(dcpMix, (cpPlusMix - cpMinusMix) / (2.0 * dT), 1e-6 * std::abs(dcpMix) + 1e-6) ||
+            !isEqual(gas.dh_mole_dT(), (hPlus - hMinus) / (2.0 * dT), tol) ||
+            !isEqual(gas.ds_mole_dT(), (sPlus - sMinus) / (2.0 * dT), tol / T)) {
+            passed = false;
+            std::cout << " Mixture derivative mismatch at T = " << T << std::endl;
+        }
+    }
+
+    if (passed) {
+        results.passedTests++;
+        std::cout << " Analytic d(cp/R)/dT max deviation from central difference: " << maxErr << " 1/K" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Analytic thermo derivative mismatch");
+    }
+}
+
+// Test HP / UV / SP state inversion
+void testStateInversion(ChemistryVars::MechanismData& mechanism, TestResults& results) {
+    std::cout << "\n===== State Inversion Tests =====\n";
+
+    IdealGasPhase gas{ MechanismView(MechanismView::Source::copyOf(mechanism)) };
+    size_t nsp = gas.nSpecies();
+    std::vector<double> y(nsp);
+    for (size_t k = 0; k < nsp; k++) y[k] = 1.0 + (k % 5);
+
+    results.totalTests++;
+    bool passed = true;
+    int maxWarm = 0, maxCold = 0;
+    const double temperatures[] = { 350.0, 999.5, 1000.5, 1734.2, 2900.0 };
+    for (double T : temperatures) {
+        const double P = 2.5e5;
+        gas.setState_TPY(T, P, y.data());
+        double h = gas.enthalpy_mass(), u = gas.intEnergy_mass(), s = gas.entropy_mass();
+        double v = 1.0 / gas.density();
+
+        // Warm start 20 K away (previous time step), cold start from far away
+        for (int mode = 0; mode < 6 && passed; mode++) {
+            double guess = mode < 3 ? T + 20.0 : 5000.0 - T;
+            gas.setState_TPY(300.0, OneAtm, y.data());
+            double target;
+            switch (mode % 3) {
+            case 0: gas.setState_HP(h, P, guess); target = gas.enthalpy_mass() - h; break;
+            case 1: gas.setState_UV(u, v, guess); target = gas.intEnergy_mass() - u; break;
+            default: gas.setState_SP(s, P, guess); target = gas.entropy_mass() - s; break;
+            }
+            int& maxIt = mode < 3 ? maxWarm : maxCold;
+            maxIt = std::max(maxIt, gas.inversionIterations());
+            if (!isEqual(gas.temperature(), T, 1e-9 * T) || !isEqual(gas.pressure(), P, 1e-9 * P)) {
+                passed = false;
+                std::cout << " Inversion mode " << mode << " at T = " << T << " gave " << gas.temperature()
+                    << " K, residual " << target << std::endl;
+            }
+        }
+    }
+    passed = passed && maxWarm <= 3;
+
+    // Targets outside the searchable range must be reported and leave the state unchanged
+    gas.setState_TP(1234.0, 2.0 * OneAtm);
+    double T0 = gas.temperature(), P0 = gas.pressure(), rho0 = gas.density();
+    for (int kind = 0; kind < 3; kind++) {
+        bool threw = false;
+        try {
+            switch (kind) {
+            case 0: gas.setState_HP(1e12, 5.0 * OneAtm, 1000.0); break;
+            case 1: gas.setState_UV(1e12, 0.1, 1000.0); break;
+            default: gas.setState_SP(1e9, 5.0 * OneAtm, 1000.0); break;
+            }
+        }
+        catch (const std::runtime_error&) {
+            threw = true;
+        }
+        passed = passed && threw && gas.temperature() == T0 && gas.pressure() == P0 && gas.density() == rho0;
+    }
+
+    if (passed) {
+        results.passedTests++;
+        std::cout << " HP/UV/SP inversions: at most " << maxWarm << " iterations (warm start), "
+            << maxCold << " (cold start)" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("State inversion failed");
+    }
+
+    // Pure N2 near 298.15 K has h close to 0, so a target within a few ulps of h(T) gives a Newton
+    // step far below one ulp of T: it rounds onto the bracket end just set and must be accepted
+    // instead of bisecting towards InversionTmax
+    results.totalTests++;
+    passed = true;
+    int maxExact = 0;
+    for (double T = 290.0; T < 310.0; T += 0.37) {
+        gas.setState_TPX(T, OneAtm, "N2:1");
+        double h = gas.enthalpy_mass();
+        for (int j = 0; j < 3; j++) {
+            gas.setState_HP(h, OneAtm, T);
+            maxExact = std::max(maxExact, gas.inversionIterations());
+            passed = passed && isEqual(gas.temperature(), T, 1e-9 * T);
+            h = std::nextafter(h, 1e300);
+        }
+    }
+    if (passed && maxExact <= 2) {
+        results.passedTests++;
+        std::cout << " Inversions started at the root: at most " << maxExact << " iterations" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("State inversion started at the root did not stop there");
+        std::cout << " Inversion started at the root took " << maxExact << " iterations" << std::endl;
+    }
+}
+
+// Test batch temperature inversion from enthalpy
+void testBatchInversion(ChemistryVars::MechanismData& mechanism, TestResults& results) {
+    std::cout << "\n===== Batch Inversion Tests =====\n";
+
+    // Second mechanism with NASA9 species exercises the exact per-state path
+    ChemistryVars::MechanismData mixed = mechanism;
+    for (size_t k = 0; k < mixed.thermoSpecies.size(); k += 3) {
+        const auto& thermo = mixed.thermoSpecies[k];
+        if (thermo.coefficients.low.size() == 7 && thermo.coefficients.high.size() == 7 &&
+            thermo.temperatureRanges.size() == 3) {
+            mixed.thermoSpecies[k] = toNasa9(thermo);
+        }
+    }
+
+    results.totalTests++;
+    bool passed = true;
+    ThermoKernels::Isa saved = ThermoKernels::activeIsa();
+    const ThermoKernels::Isa isas[] = { ThermoKernels::Isa::Scalar, ThermoKernels::Isa::AVX2, ThermoKernels::Isa::AVX512 };
+    double meanIterations = 0.0;
+    for (int variant = 0; variant < 2; variant++) {
+        IdealGasPhase gas{ MechanismView(MechanismView::Source::copyOf(variant == 0 ? mechanism : mixed)) };
+        ThermoBatch batch(gas);
+        size_t nsp = gas.nSpecies();
+        const size_t n = 999;
+
+        std::vector<double> T(n), Y(n * nsp), h(n), guess(n);
+        unsigned seed = 2024;
+        auto next = [&seed]() { seed = seed * 1103515245u + 12345u; return (seed >> 8) / 16777216.0; };
+        for (size_t i = 0; i < n; i++) {
+            T[i] = 300.0 + 2600.0 * next();
+            guess[i] = T[i] + 60.0 * (next() - 0.5);
+            for (size_t k = 0; k < nsp; k++) Y[i * nsp + k] = next() < 0.5 ? 0.0 : next();
+            Y[i * nsp + i % nsp] += 0.1;
+        }
+        ThermoBatch::States states;
+        states.n = n;
+        states.T = T.data();
+        states.Y = Y.data();
+        states.stateStride = nsp;
+        ThermoBatch::Properties out;
+        out.enthalpy_mass = h.data();
+        batch.evaluate(states, out, 1);
+
+        for (ThermoKernels::Isa isa : isas) {
+            if (!ThermoKernels::isSupported(isa) || (variant == 1 && isa != ThermoKernels::Isa::Scalar)) continue;
+            ThermoKernels::setIsa(isa);
+            std::vector<double> solved = guess;
+            states.T = solved.data();
+            ThermoBatch::InversionStats stats = batch.invertEnthalpy(states, h.data(), 1, solved.data(), 1, 1);
+            for (size_t i = 0; i < n; i++) {
+                if (!isEqual(solved[i], T[i], 1e-9 * T[i])) {
+                    passed = false;
+                    std::cout << " " << ThermoKernels::isaName(isa) << " state " << i << ": " << solved[i]
+                        << " vs " << T[i] << std::endl;
+                    break;
+                }
+            }
+            passed = passed && stats.nStates == n && stats.nFailed == 0 && stats.maxIterations <= 4;
+            if (variant == 0) meanIterations = std::max(meanIterations, stats.meanIterations());
+        }
+        ThermoKernels::setIsa(saved);
+
+        // An unreachable enthalpy is reported as a failure without disturbing the other states
+        std::vector<double> solved = guess;
+        h[7] = 1e12;
+        states.T = solved.data();
+        ThermoBatch::InversionStats stats = batch.invertEnthalpy(states, h.data(), 1, solved.data(), 1, 4);
+        passed = passed && stats.nFailed == 1 && isEqual(solved[8], T[8], 1e-9 * T[8]);
+    }
+
+    if (passed) {
+        results.passedTests++;
+        std::cout << " Batch T(h) inversion matches on all ISAs, mean " << meanIterations << " iterations" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Batch temperature inversion mismatch");
+    }
+}
+
+// Test Gibbs equilibrium by element potentials
+void testEquilibrium(ChemistryVars::MechanismData& mechanism, TestResults& results) {
+    std::cout << "\n===== Equilibrium Tests =====\n";
+
+    IdealGasPhase gas{ MechanismView(MechanismView::Source::copyOf(mechanism)) };
+    size_t nsp = gas.nSpecies();
+    size_t nel = gas.nElements();
+    const double P = 101325.0;
+    const std::string mixture = "H2:2, O2:1, N2:4";
+
+    // Element moles per unit mass of the current state
+    auto elementMoles = [&gas, nsp, nel]() {
+        std::vector<double> moles(nsp), b(nel);
+        for (size_t k = 0; k < nsp; k++) moles[k] = gas.massFraction(k) / gas.molecularWeights()[k];
+        gas.elements().getElementMoles(moles.data(), b.data());
+        return b;
+    };
+    auto sameElements = [](const std::vector<double>& a, const std::vector<double>& b) {
+        for (size_t m = 0; m < a.size(); m++) {
+            if (!isEqual(a[m], b[m], 1e-10 * std::max(a[m], 1e-3))) return false;
+        }
+        return true;
+    };
+    // Gibbs energy must rise when moles are shifted along an element-conserving reaction
+    auto gibbsMinimum = [&gas, nsp](const std::map<std::string, double>& nu) {
+        double T = gas.temperature();
+        double p = gas.pressure();
+        double g0 = gas.gibbs_mass();
+        std::vector<double> X(nsp);
+        for (size_t k = 0; k < nsp; k++) X[k] = gas.moleFraction(k);
+        for (const auto& item : nu) {
+            if (gas.speciesIndex(item.first) == static_cast<size_t>(-1)) return true;
+        }
+        bool minimum = true;
+        for (double sign : { -1.0, 1.0 }) {
+            std::vector<double> n = X;
+            for (const auto& item : nu) n[gas.speciesIndex(item.first)] += sign * 1e-6 * item.second;
+            gas.setState_TPX(T, p, n.data());
+            minimum = minimum && gas.gibbs_mass() > g0;
+        }
+        gas.setState_TPX(T, p, X.data());
+        return minimum;
+    };
+
+    // TP: temperature and pressure are kept, composition minimizes G
+    results.totalTests++;
+    gas.setState_TPX(3000.0, P, mixture);
+    std::vector<double> b0 = elementMoles();
+    gas.equilibrate("TP");
+    bool passed = isEqual(gas.temperature(), 3000.0, 1e-9) && isEqual(gas.pressure(), P, 1e-6) &&
+        sameElements(elementMoles(), b0) &&
+        gibbsMinimum({ { "H2O", -2.0 }, { "H2", 2.0 }, { "O2", 1.0 } }) &&
+        gibbsMinimum({ { "H2", -1.0 }, { "H", 2.0 } }) &&
+        gibbsMinimum({ { "H2O", -2.0 }, { "H2", 1.0 }, { "OH", 2.0 } });
+    double xH2O = gas.moleFraction(gas.speciesIndex("H2O"));
+    if (passed && xH2O > 0.1) {
+        results.passedTests++;
+        std::cout << " TP equilibrium at 3000 K: x(H2O) = " << xH2O << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("TP equilibrium mismatch");
+    }
+
+    // HP, SP, UV: the two properties are conserved and the burnt temperature is physical
+    results.totalTests++;
+    passed = true;
+    for (const std::string XY : { "HP", "SP", "UV" }) {
+        gas.setState_TPX(300.0, P, mixture);
+        double h = gas.enthalpy_mass();
+        double s = gas.entropy_mass();
+        double u = gas.intEnergy_mass();
+        double v = 1.0 / gas.density();
+        gas.equilibrate(XY);
+        if (XY == "HP") passed = passed && isEqual(gas.enthalpy_mass(), h, 1e-6 * std::abs(h) + 1e-3);
+        if (XY == "SP") passed = passed && isEqual(gas.entropy_mass(), s, 1e-9 * s);
+        if (XY == "UV") passed = passed && isEqual(gas.intEnergy_mass(), u, 1e-6 * std::abs(u) + 1e-3) &&
+            isEqual(1.0 / gas.density(), v, 1e-9 * v);
+        if (XY != "UV") passed = passed && isEqual(gas.pressure(), P, 1e-6);
+        passed = passed && sameElements(elementMoles(), b0);
+        bool burnt = gas.temperature() > 2000.0 && gas.temperature() < 3500.0;
+        if (burnt) passed = passed && gibbsMinimum({ { "H2O", -2.0 }, { "H2", 2.0 }, { "O2", 1.0 } });
+        // The isentropic state stays cool, with H2 only at trace level
+        if (XY == "SP") burnt = gas.temperature() > 300.0 && gas.temperature() < 1000.0;
+        if (!burnt) {
+            passed = false;
+            std::cout << " " << XY << ": T = " << gas.temperature() << std::endl;
+        }
+    }
+    if (passed) {
+        results.passedTests++;
+        std::cout << " HP/SP/UV equilibrium conserves the constrained properties" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("HP/SP/UV equilibrium mismatch");
+    }
+
+    // Warm start from the previous solution takes fewer iterations than a cold start
+    results.totalTests++;
+    GasEquilibrium solver;
+    gas.setState_TPX(300.0, P, mixture);
+    solver.equilibrate(gas, GasEquilibrium::Constraint::HP);
+    int cold = solver.iterations();
+    double T1 = gas.temperature();
+    gas.setState_TPX(320.0, P, mixture);
+    solver.equilibrate(gas, "PH");
+    int warm = solver.iterations();
+    passed = solver.warmStarted() && warm < cold && gas.temperature() > T1 &&
+        solver.residual() <= solver.options().tolerance;
+    if (passed) {
+        results.passedTests++;
+        std::cout << " Warm start: " << warm << " iterations vs " << cold << " cold" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Equilibrium warm start mismatch");
+    }
+
+    // Trace species keep tiny positive mole fractions whose ratios give the same Kp at any pressure
+    results.totalTests++;
+    double Kp[2] = { 0.0, 0.0 };
+    double xH2 = 0.0;
+    passed = true;
+    for (int i = 0; i < 2; i++) {
+        double p = i == 0 ? P : 10.0 * P;
+        gas.setState_TPX(800.0, p, "H2:0.01, O2:1, N2:4");
+        gas.equilibrate("TP");
+        xH2 = gas.moleFraction(gas.speciesIndex("H2"));
+        double xO2 = gas.moleFraction(gas.speciesIndex("O2"));
+        double xH2O = gas.moleFraction(gas.speciesIndex("H2O"));
+        Kp[i] = 2.0 * std::log(xH2 / xH2O) + std::log(xO2 * p / gas.refPressure());
+        for (size_t k = 0; k < nsp; k++) passed = passed && gas.moleFraction(k) >= 0.0;
+    }
+    passed = passed && xH2 > 0.0 && xH2 < 1e-12 && isEqual(Kp[0], Kp[1], 1e-8);
+    try {
+        GasEquilibrium::parseConstraint("TV");
+        passed = false;
+    }
+    catch (const std::invalid_argument&) {
+    }
+    if (passed) {
+        results.passedTests++;
+        std::cout << " Trace H2 at 800 K: x = " << xH2 << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Equilibrium trace species mismatch");
+    }
+}
+
+// Test the batch equilibrium table driver against single-point solves
+void testEquilibriumTable(ChemistryVars::MechanismData& mechanism, TestResults& results) {
+    std::cout << "\n===== Equilibrium Table Tests =====\n";
+
+    IdealGasPhase gas{ MechanismView(MechanismView::Source::copyOf(mechanism)) };
+    size_t nsp = gas.nSpecies();
+    EquilibriumTable table(gas, "H2:1", 300.0, "O2:0.21, N2:0.79", 800.0);
+
+    EquilibriumTable::Grid grid;
+    for (int i = 0; i <= 10; i++) grid.Z.push_back(0.01 * i);
+    grid.enthalpyDefect = { 0.0, -2e5, -5e6 };  // the last is unreachable on the lean side
+    grid.P = { 5000.0, OneAtm, 5.0 * OneAtm };  // 5000 Pa is below setPressure's atm threshold
+    size_t n = grid.nPoints();
+
+    results.totalTests++;
+    std::vector<double> T1(n), T3(n), Y(n * nsp), rho(n);
+    EquilibriumTable::Output out;
+    out.T = T1.data();
+    out.Y = Y.data();
+    out.density = rho.data();
+    EquilibriumTable::Stats serial = table.compute(grid, out, 1);
+    EquilibriumTable::Output out3;
+    out3.T = T3.data();
+    EquilibriumTable::Stats parallel = table.compute(grid, out3, 3);
+
+    bool passed = serial.nPoints == n && parallel.nPoints == n && serial.nFailed == parallel.nFailed &&
+        serial.nFailed > 0 && serial.nFailed < n / 3 + 1;
+    GasEquilibrium solver;
+    for (size_t iP = 0; iP < grid.P.size() && passed; iP++) {
+        for (size_t iH = 0; iH < grid.enthalpyDefect.size(); iH++) {
+            for (size_t iZ = 0; iZ < grid.Z.size(); iZ++) {
+                size_t i = grid.index(iZ, iH, iP);
+                if (std::isnan(T1[i])) {
+                    passed = passed && iH == 2 && std::isnan(T3[i]) && std::isnan(Y[i * nsp]);
+                    continue;
+                }
+                // Independent cold solve of the same point
+                std::vector<double> y(nsp), yFuel(nsp), yOxidizer(nsp);
+                gas.setState_TPX(300.0, OneAtm, "H2:1");
+                gas.getMassFractions(yFuel.data());
+                gas.setState_TPX(300.0, OneAtm, "O2:0.21, N2:0.79");
+                gas.getMassFractions(yOxidizer.data());
+                double Z = grid.Z[iZ];
+                for (size_t k = 0; k < nsp; k++) y[k] = Z * yFuel[k] + (1.0 - Z) * yOxidizer[k];
+                gas.setTemperature(300.0);
+                gas.setMassFractions(y.data());
+                gas.setPressurePa(grid.P[iP]);
+                solver.reset();
+                solver.equilibrate(gas, GasEquilibrium::Constraint::HP,
+                    table.mixtureEnthalpy(Z) + grid.enthalpyDefect[iH]);
+                double rhoIdeal = grid.P[iP] * gas.meanMolecularWeight() / (GasConstant * T1[i]);
+                if (!isEqual(T1[i], gas.temperature(), 1e-5) || !isEqual(T3[i], T1[i], 1e-5) ||
+                    !isEqual(rho[i], gas.density(), 1e-9 * rho[i]) || !isEqual(rho[i], rhoIdeal, 1e-6 * rhoIdeal) ||
+                    !isEqual(Y[i * nsp + gas.speciesIndex("H2O")], gas.massFraction(gas.speciesIndex("H2O")), 1e-9)) {
+                    passed = false;
+                    std::cout << " point (" << iZ << ", " << iH << ", " << iP << "): T = " << T1[i]
+                        << " vs " << gas.temperature() << std::endl;
+                }
+            }
+        }
+    }
+    if (passed) {
+        results.passedTests++;
+        std::cout << " " << n << " points, " << serial.nFailed << " unreachable, mean "
+            << serial.meanIterations() << " iterations per point" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Equilibrium table mismatch");
+    }
+}
+
+// Test single- and mixed-precision thermo evaluation against the double path
+void testPrecision(ChemistryVars::MechanismData& mechanism, TestResults& results) {
+    std::cout << "\n===== Precision Tests =====\n";
+
+    IdealGasPhase gas{ MechanismView(MechanismView::Source::copyOf(mechanism)) };
+    std::shared_ptr<const SpeciesThermo> species = gas.speciesThermo();
+    size_t nsp = gas.nSpecies();
+    std::vector<double> Xd(nsp);
+    for (size_t k = 0; k < nsp; k++) Xd[k] = 1.0 + k % 3;
+    double total = 0.0;
+    for (double x : Xd) total += x;
+    for (double& x : Xd) x /= total;
+    std::vector<float> Xf(Xd.begin(), Xd.end());
+
+    // The double instantiation reproduces IdealGasPhase
+    results.totalTests++;
+    ThermoEvaluatorF64 f64(species);
+    bool passed = true;
+    for (double T = 300.0; T <= 3000.0; T += 270.0) {
+        gas.setState_TPX(T, OneAtm, Xd.data());
+        f64.update(T);
+        passed = passed && isEqual(f64.cp_mass(Xd.data()), gas.cp_mass(), 1e-9 * std::abs(gas.cp_mass())) &&
+            isEqual(f64.enthalpy_mass(Xd.data()), gas.enthalpy_mass(), 1e-9 * (std::abs(gas.enthalpy_mass()) + 1.0)) &&
+            isEqual(f64.entropy_mass(Xd.data(), OneAtm), gas.entropy_mass(), 1e-9 * gas.entropy_mass());
+    }
+    if (passed) {
+        results.passedTests++;
+        std::cout << "  [PASS] Double evaluator matches IdealGasPhase" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Double ThermoEvaluator differs from IdealGasPhase");
+    }
+
+    // Float species properties within single-precision rounding of the double path
+    results.totalTests++;
+    PrecisionReport f32 = precisionReport<float, float>(species, 300.0, 3000.0, 10.0);
+    PrecisionReport mixed = precisionReport<float, double>(species, 300.0, 3000.0, 10.0);
+    PrecisionReport exact = precisionReport<double, double>(species, 300.0, 3000.0, 10.0);
+    double worst = std::max(f32.worst.h_RT, std::max(f32.worst.s_R, f32.worst.cp_R));
+    if (worst > 0.0 && worst < 1e-4 && f32.species.size() == nsp &&
+        exact.worst.h_RT == 0.0 && exact.worst.s_R == 0.0 && exact.worst.cp_R == 0.0) {
+        results.passedTests++;
+        std::cout << "  [PASS] Float species error " << std::scientific << std::setprecision(2) << worst
+            << " (worst: " << f32.worst.name << ")" << std::defaultfloat << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Float species error too large: " + std::to_string(worst));
+    }
+
+    // Double accumulation shares the species error but not the summation error
+    results.totalTests++;
+    if (mixed.worst.h_RT == f32.worst.h_RT && mixed.cp_mass <= f32.cp_mass && mixed.entropy_mass <= f32.entropy_mass &&
+        std::max(f32.cp_mass, std::max(f32.enthalpy_mass, f32.entropy_mass)) < 1e-5) {
+        results.passedTests++;
+        std::cout << "  [PASS] Mixed precision cp_mass error " << std::scientific << std::setprecision(2)
+            << mixed.cp_mass << " vs float " << f32.cp_mass << std::defaultfloat << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Mixed precision not more accurate than float accumulation");
+    }
+
+    // Float kernels agree across instruction sets
+    results.totalTests++;
+    Nasa7TableF table(mechanism.thermoSpecies);
+    size_t n = table.nSpecies();
+    std::vector<float> h0(n), s0(n), cp0(n), h(n), s(n), cp(n);
+    passed = true;
+    const ThermoKernels::Isa isas[] = { ThermoKernels::Isa::AVX2, ThermoKernels::Isa::AVX512 };
+    for (double T = 300.0; T <= 3000.0; T += 135.0) {
+        ThermoKernels::evaluate(ThermoKernels::Isa::Scalar, table, T, h0.data(), s0.data(), cp0.data());
+        for (ThermoKernels::Isa isa : isas) {
+            if (!ThermoKernels::isSupported(isa)) continue;
+            ThermoKernels::evaluate(isa, table, T, h.data(), s.data(), cp.data());
+            for (size_t k = 0; k < n; k++) {
+                passed = passed && isEqual(h[k], h0[k], 1e-5f * std::max(std::abs(h0[k]), 1.0f)) &&
+                    isEqual(s[k], s0[k], 1e-5f * std::max(std::abs(s0[k]), 1.0f)) &&
+                    isEqual(cp[k], cp0[k], 1e-5f * std::max(std::abs(cp0[k]), 1.0f));
+            }
+        }
+    }
+    if (passed) {
+        results.passedTests++;
+        std::cout << "  [PASS] Float kernels agree across ISAs" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Float kernels differ between ISAs");
+    }
+}
+
+// Test generation of the mechanism-specialized thermo header
+// (the generated code itself is compiled and checked against the runtime path by the ThermoCodegen ctest)
+void testThermoCodegen(ChemistryVars::MechanismData& mechanism, TestResults& results) {
+    std::cout << "\n===== Thermo Codegen Tests =====\n";
+
+    results.totalTests++;
+    bool passed = ThermoCodegen::identifierFromPath("dir/C2H4-mechanism.yaml") == "C2H4_mechanism" &&
+        ThermoCodegen::identifierFromPath("C:\\data\\2step.yaml") == "m_2step";
+    try {
+        ThermoCodegen::generateHeader(std::vector<ChemistryVars::ThermoData>());
+        passed = false;
+    }
+    catch (const std::invalid_argument&) {
+    }
+    if (passed) {
+        results.passedTests++;
+        std::cout << "  [PASS] Namespace names and empty-mechanism error" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("ThermoCodegen identifier or empty-input handling wrong");
+    }
+
+    // Every species appears in the name table and in the unrolled evaluation
+    results.totalTests++;
+    ThermoCodegen::Options options;
+    options.namespaceName = "test_thermo";
+    std::string header = ThermoCodegen::generateHeader(mechanism.thermoSpecies, options);
+    std::string test = ThermoCodegen::generateTest(mechanism.thermoSpecies, "test_thermo.h", options);
+    size_t n = mechanism.thermoSpecies.size();
+    passed = header.find("namespace test_thermo {") != std::string::npos &&
+        header.find("NSpecies = " + std::to_string(n) + ";") != std::string::npos &&
+        test.find("#include \"test_thermo.h\"") != std::string::npos;
+    for (size_t k = 0; k < n && passed; k++) {
+        passed = header.find("\"" + mechanism.thermoSpecies[k].name + "\"") != std::string::npos &&
+            header.find("cp_R[" + std::to_string(k) + "] = ") != std::string::npos;
+    }
+    if (passed) {
+        results.passedTests++;
+        std::cout << "  [PASS] Generated header covers " << n << " species (" << header.size() / 1024 << " KB)" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Generated thermo header is missing species");
+    }
+}
+
+// Test the state version counter and the cached mixture reductions
+void testStateCache(ChemistryVars::MechanismData& mechanism, TestResults& results) {
+    std::cout << "\n===== State Cache Tests =====\n";
+
+    auto source = MechanismView::Source::copyOf(mechanism);
+    IdealGasPhase gas{ MechanismView(source) };
+    size_t nsp = gas.nSpecies();
+    std::vector<double> X(nsp), Y(nsp);
+    for (size_t k = 0; k < nsp; k++) X[k] = 1.0 + k % 4;
+
+    // Every setter bumps the version, getters do not
+    results.totalTests++;
+    bool passed = true;
+    uint64_t v = gas.stateVersion();
+    auto bumped = [&gas, &v]() {
+        bool changed = gas.stateVersion() > v;
+        v = gas.stateVersion();
+        return changed;
+    };
+    gas.setState_TPX(1200.0, OneAtm, X.data());
+    passed = passed && bumped();
+    gas.cp_mass();
+    gas.entropy_mass();
+    gas.density();
+    passed = passed && !bumped();
+    gas.setTemperature(1300.0);
+    passed = passed && bumped();
+    gas.setPressure(2.0 * OneAtm);
+    passed = passed && bumped();
+    gas.setMoleFractions(X.data());
+    passed = passed && bumped();
+    gas.getMassFractions(Y.data());
+    gas.setMassFractions(Y.data());
+    passed = passed && bumped();
+    gas.setState_HP(gas.enthalpy_mass() + 1e5, gas.pressure());
+    passed = passed && bumped();
+    gas.setState_UV(gas.intEnergy_mass(), 1.0 / gas.density());
+    passed = passed && bumped();
+    ThermoTable::Options tableOptions;
+    tableOptions.Tmin = 300.0;
+    tableOptions.Tmax = 3000.0;
+    gas.enableThermoTable(tableOptions);
+    passed = passed && bumped();
+    gas.disableThermoTable();
+    passed = passed && bumped();
+    if (passed) {
+        results.passedTests++;
+        std::cout << "  [PASS] Setters bump the state version, getters do not" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("State version not bumped by a setter or bumped by a getter");
+    }
+
+    // Repeated getters after each kind of change match a phase with no history
+    results.totalTests++;
+    passed = true;
+    auto matches = [&source, nsp](const IdealGasPhase& cached) {
+        IdealGasPhase fresh{ MechanismView(source) };
+        std::vector<double> x(nsp);
+        cached.getMoleFractions(x.data());
+        fresh.setState_TPX(cached.temperature(), cached.pressure(), x.data());
+        if (cached.thermoTable()) fresh.setThermoTable(cached.thermoTable());
+        double values[2][8];
+        const IdealGasPhase* phases[2] = { &cached, &fresh };
+        for (int i = 0; i < 2; i++) {
+            for (int repeat = 0; repeat < 2; repeat++) {
+                const IdealGasPhase& p = *phases[i];
+                double row[8] = { p.meanMolecularWeight(), p.density(), p.enthalpy_mass(), p.entropy_mass(),
+                    p.gibbs_mass(), p.cp_mass(), p.cv_mass(), p.intEnergy_mass() };
+                std::copy(row, row + 8, values[i]);
+            }
+        }
+        // the fresh phase renormalizes X, so allow rounding differences
+        for (int j = 0; j < 8; j++) {
+            if (!isEqual(values[0][j], values[1][j], 1e-12 * std::max(std::abs(values[1][j]), 1.0))) return false;
+        }
+        return true;
+    };
+    gas.setState_TPX(900.0, OneAtm, X.data());
+    passed = passed && matches(gas);
+    X[0] *= 3.0;
+    gas.setMoleFractions(X.data());
+    passed = passed && matches(gas);
+    gas.setTemperature(1700.0);
+    passed = passed && matches(gas);
+    gas.setPressure(10.0 * OneAtm);
+    passed = passed && matches(gas);
+    gas.getMassFractions(Y.data());
+    std::reverse(Y.begin(), Y.end());
+    gas.setMassFractions(Y.data());
+    passed = passed && matches(gas);
+    gas.setState_SP(gas.entropy_mass() - 100.0, gas.pressure());
+    passed = passed && matches(gas);
+    gas.enableThermoTable(tableOptions);
+    gas.setTemperature(1234.5);
+    passed = passed && matches(gas);
+    gas.disableThermoTable();
+    passed = passed && matches(gas);
+    if (passed) {
+        results.passedTests++;
+        std::cout << "  [PASS] Cached mixture properties never stale" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Cached mixture property differs from a fresh phase");
+    }
+}
+
+// Test the fused all-properties bundle
+void testPropertyBundle(ChemistryVars::MechanismData& mechanism, TestResults& results) {
+    std::cout << "\n===== Property Bundle Tests =====\n";
+
+    auto source = MechanismView::Source::copyOf(mechanism);
+    IdealGasPhase gas{ MechanismView(source) };
+    size_t nsp = gas.nSpecies();
+    std::vector<double> X(nsp);
+    for (size_t k = 0; k < nsp; k++) X[k] = 1.0 + k % 5;
+
+    // The bundle equals the individual getters of a phase in the same state, and those of the
+    // bundled phase itself afterwards (the bundle fills the mixture cache)
+    results.totalTests++;
+    bool passed = true;
+    const double temperatures[] = { 300.0, 1000.0, 2500.0 };
+    const double pressures[] = { 0.5 * OneAtm, 20.0 * OneAtm };
+    for (double T : temperatures) {
+        for (double P : pressures) {
+            gas.setState_TPX(T, P, X.data());
+            IdealGasPhase::Properties props;
+            gas.getProperties(props);
+            IdealGasPhase fresh = gas;
+            fresh.setState_TPX(T, P, X.data());
+            const IdealGasPhase* phases[2] = { &fresh, &gas };
+            for (const IdealGasPhase* p : phases) {
+                double expected[] = { p->temperature(), p->pressure(), p->meanMolecularWeight(), p->density(),
+                    p->enthalpy_mole(), p->intEnergy_mole(), p->entropy_mole(), p->gibbs_mole(), p->cp_mole(),
+                    p->cv_mole(), p->enthalpy_mass(), p->intEnergy_mass(), p->entropy_mass(), p->gibbs_mass(),
+                    p->cp_mass(), p->cv_mass() };
+                double actual[] = { props.temperature, props.pressure, props.meanMolecularWeight, props.density,
+                    props.enthalpy_mole, props.intEnergy_mole, props.entropy_mole, props.gibbs_mole, props.cp_mole,
+                    props.cv_mole, props.enthalpy_mass, props.intEnergy_mass, props.entropy_mass, props.gibbs_mass,
+                    props.cp_mass, props.cv_mass };
+                for (size_t j = 0; j < sizeof(expected) / sizeof(expected[0]); j++) {
+                    passed = passed && actual[j] == expected[j];
+                }
+            }
+            passed = passed && isEqual(props.molarDensity, props.density / props.meanMolecularWeight, 1e-15) &&
+                isEqual(props.gamma, props.cp_mass / props.cv_mass, 1e-14);
+        }
+    }
+    if (passed) {
+        results.passedTests++;
+        std::cout << "  [PASS] getProperties matches the individual getters" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("getProperties differs from the individual getters");
+    }
+
+    // Frozen sound speed of pure N2 at 300 K is about 353 m/s
+    size_t iN2 = gas.speciesIndex("N2");
+    if (iN2 != std::string::npos) {
+        results.totalTests++;
+        std::vector<double> pure(nsp, 0.0);
+        pure[iN2] = 1.0;
+        gas.setState_TPX(300.0, OneAtm, pure.data());
+        IdealGasPhase::Properties props;
+        gas.getProperties(props);
+        if (isEqual(props.gamma, 1.4, 0.002) && isEqual(props.soundSpeed, 353.0, 1.0)) {
+            results.passedTests++;
+            std::cout << "  [PASS] N2 sound speed at 300 K: " << std::fixed << std::setprecision(1)
+                << props.soundSpeed << " m/s" << std::defaultfloat << std::endl;
+        }
+        else {
+            results.failureMessages.push_back("N2 sound speed at 300 K out of range: " + std::to_string(props.soundSpeed));
+        }
+    }
+}
+
+// Test the per-species standard-state and partial molar getters
+void testSpeciesProperties(ChemistryVars::MechanismData& mechanism, TestResults& results) {
+    std::cout << "\n===== Species Property Tests =====\n";
+
+    IdealGasPhase gas{ MechanismView(MechanismView::Source::copyOf(mechanism)) };
+    size_t nsp = gas.nSpecies();
+    std::vector<double> X(nsp);
+    for (size_t k = 0; k < nsp; k++) X[k] = 1.0 + k % 3;
+    gas.setState_TPX(1500.0, 5.0 * OneAtm, X.data());
+    gas.getMoleFractions(X.data());
+
+    // Mole-fraction weighted partial molar properties sum to the mixture properties
+    results.totalTests++;
+    std::vector<double> mu(nsp), hbar(nsp), sbar(nsp), ubar(nsp), cpbar(nsp), vbar(nsp);
+    gas.getChemPotentials(mu.data());
+    gas.getPartialMolarEnthalpies(hbar.data());
+    gas.getPartialMolarEntropies(sbar.data());
+    gas.getPartialMolarIntEnergies(ubar.data());
+    gas.getPartialMolarCp(cpbar.data());
+    gas.getPartialMolarVolumes(vbar.data());
+    double sums[6] = {};
+    for (size_t k = 0; k < nsp; k++) {
+        sums[0] += X[k] * mu[k];
+        sums[1] += X[k] * hbar[k];
+        sums[2] += X[k] * sbar[k];
+        sums[3] += X[k] * ubar[k];
+        sums[4] += X[k] * cpbar[k];
+        sums[5] += X[k] * vbar[k];
+    }
+    double expected[6] = { gas.gibbs_mole(), gas.enthalpy_mole(), gas.entropy_mole(), gas.intEnergy_mole(),
+        gas.cp_mole(), gas.meanMolecularWeight() / gas.density() };
+    bool passed = true;
+    for (int j = 0; j < 6; j++) {
+        passed = passed && isEqual(sums[j], expected[j], 1e-10 * std::max(std::abs(expected[j]), 1.0));
+    }
+    if (passed) {
+        results.passedTests++;
+        std::cout << "  [PASS] Partial molar properties sum to the mixture properties" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Partial molar properties do not sum to the mixture properties");
+    }
+
+    // Standard-state arrays are consistent with each other and with the chemical potentials
+    results.totalTests++;
+    std::vector<double> hrt(nsp), sr(nsp), grt(nsp), cpr(nsp), urt(nsp), mu0(nsp);
+    gas.getEnthalpy_RT(hrt.data());
+    gas.getEntropy_R(sr.data());
+    gas.getGibbs_RT(grt.data());
+    gas.getCp_R(cpr.data());
+    gas.getIntEnergy_RT(urt.data());
+    gas.getStandardChemPotentials(mu0.data());
+    double RT = gas.RT();
+    passed = true;
+    for (size_t k = 0; k < nsp; k++) {
+        double scale = std::max(std::abs(hrt[k]) + std::abs(sr[k]), 1.0);
+        passed = passed && isEqual(grt[k], hrt[k] - sr[k], 1e-12 * scale) &&
+            isEqual(urt[k], hrt[k] - 1.0, 1e-12 * scale) &&
+            isEqual(mu0[k], RT * grt[k], 1e-12 * RT * scale) &&
+            isEqual(mu[k], mu0[k] + RT * std::log(X[k]), 1e-12 * RT * scale) &&
+            isEqual(cpbar[k], GasConstant * cpr[k], 1e-12 * GasConstant * cpr[k]);
+    }
+    if (passed) {
+        results.passedTests++;
+        std::cout << "  [PASS] Standard-state arrays consistent with chemical potentials" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Standard-state species arrays inconsistent");
+    }
+}
+
+// Test sub-mechanism views built from a shared parent
+void testViews(ChemistryVars::MechanismData& mechanism, TestResults& results) {
+    std::cout << "\n===== Sub-mechanism View Tests =====\n";
+
+    auto source = MechanismView::Source::copyOf(mechanism);
+    MechanismView full(source);
+    MechanismView noNitrogen = MechanismView::withoutElements(source, { "N" }, { "N2" });
+    MechanismView h2o2 = MechanismView::withSpecies(source,
+        { "H2", "H", "O2", "O", "H2O", "OH", "H2O2", "HO2", "N2" });
+
+    results.totalTests++;
+    bool passed = full.nSpecies() == mechanism.thermoSpecies.size() &&
+        full.nReactions() == mechanism.reactions.size() &&
+        noNitrogen.speciesIndex("N2") != std::string::npos;
+
+    // Every reaction in a subset view must only involve species of that view
+    for (const MechanismView* view : { &noNitrogen, &h2o2 }) {
+        for (size_t i = 0; i < view->nReactions(); i++) {
+            ReactionIndex::Stoichiometry st = ReactionIndex::parseEquation(view->reaction(i).equation);
+            for (const auto& sp : st.reactants) {
+                if (view->speciesIndex(sp.first) == std::string::npos) passed = false;
+            }
+            for (const auto& sp : st.products) {
+                if (view->speciesIndex(sp.first) == std::string::npos) passed = false;
+            }
+        }
+    }
+
+    if (passed && h2o2.nReactions() > 0 && h2o2.nReactions() < full.nReactions()) {
+        results.passedTests++;
+        std::cout << " H2/O2 view: " << h2o2.nSpecies() << " species, " << h2o2.nReactions()
+            << " reactions closed over the subset" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Sub-mechanism view closure mismatch");
+        std::cout << " Sub-mechanism view closure mismatch" << std::endl;
+    }
+
+    // A source shares the caller's mechanism without copying it, and its views keep it alive
+    // after the caller releases it
+    results.totalTests++;
+    std::unique_ptr<MechanismView> detached;
+    {
+        auto shared = std::make_shared<const ChemistryVars::MechanismData>(mechanism);
+        auto sharedSource = std::make_shared<const MechanismView::Source>(shared);
+        passed = sharedSource->mechanismPtr() == shared && &sharedSource->mechanism() == shared.get();
+        detached.reset(new MechanismView(sharedSource));
+    }
+    if (passed && detached->nReactions() == mechanism.reactions.size() &&
+        detached->reaction(0).equation == mechanism.reactions[0].equation) {
+        results.passedTests++;
+        std::cout << " View outlives its parent mechanism" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Sub-mechanism view lost its parent mechanism");
+    }
+}
+
+// Test merging a mechanism with itself and with one of its own sub-mechanisms
+void testMerge(ChemistryVars::MechanismData& mechanism, TestResults& results) {
+    std::cout << "\n===== Mechanism Merge Tests =====\n";
+
+    auto source = MechanismView::Source::copyOf(mechanism);
+    ChemistryVars::MechanismData noCarbon = MechanismView::withoutElements(source, { "C" }).materialize();
+    MechanismMerge::Result self = MechanismMerge::merge(mechanism, mechanism);
+    MechanismMerge::Result joined = MechanismMerge::merge(noCarbon, mechanism);
+
+    // Efficiencies dropped from the sub-mechanism are restored from the full one
+    auto countEfficiencies = [](const ChemistryVars::MechanismData& m) {
+        size_t n = 0;
+        for (const auto& reaction : m.reactions) n += reaction.efficiencies.size();
+        return n;
+    };
+
+    results.totalTests++;
+    if (self.conflicts.empty() && self.speciesAdded == 0 && self.reactionsAdded == 0 &&
+        joined.conflicts.empty() && countEfficiencies(joined.mechanism) == countEfficiencies(mechanism) &&
+        joined.mechanism.thermoSpecies.size() == mechanism.thermoSpecies.size() &&
+        joined.mechanism.reactions.size() == mechanism.reactions.size()) {
+        results.passedTests++;
+        std::cout << " Merge test passed: " << joined.reactionsShared << " shared and "
+            << joined.reactionsAdded << " added reactions" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Mechanism merge mismatch");
+        std::cout << " Mechanism merge mismatch: " << self.conflicts.size() + joined.conflicts.size()
+            << " conflicts, " << joined.mechanism.reactions.size() << " reactions" << std::endl;
+    }
+
+    // Opposite-direction irreversible reactions are distinct; a reversible pair with different rates conflicts
+    results.totalTests++;
+    ChemistryVars::MechanismData forward, backward, reversible, reversed;
+    forward.reactions.resize(1);
+    forward.reactions[0].equation = "H2 + O => H + OH";
+    forward.reactions[0].rateConstant.A = 1.0e13;
+    backward.reactions.resize(1);
+    backward.reactions[0].equation = "OH + H => O + H2";
+    backward.reactions[0].rateConstant.A = 2.0e13;
+    reversible = forward;
+    reversible.reactions[0].equation = "H2 + O <=> H + OH";
+    reversed = backward;
+    reversed.reactions[0].equation = "OH + H <=> O + H2";
+    MechanismMerge::Result opposite = MechanismMerge::merge(forward, backward);
+    MechanismMerge::Result conflicting = MechanismMerge::merge(reversible, reversed);
+    if (opposite.conflicts.empty() && opposite.reactionsAdded == 1 && opposite.mechanism.reactions.size() == 2 &&
+        conflicting.conflicts.size() == 1 &&
+        conflicting.conflicts[0].kind == MechanismMerge::Conflict::Kind::DuplicateReaction &&
+        conflicting.mechanism.reactions.size() == 1) {
+        results.passedTests++;
+        std::cout << " Opposite irreversible reactions kept, reversible duplicate reported" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Merge treats opposite irreversible reactions as duplicates");
+    }
+}
+
+// Test DRG reduction with synthetic rates of progress
+void testReduction(ChemistryVars::MechanismData& mechanism, TestResults& results) {
+    std::cout << "\n===== DRG Reduction Tests =====\n";
+
+    if (mechanism.reactions.empty()) return;
+
+    // Two synthetic states: uniform rates and rates decaying with reaction index
+    std::vector<std::vector<double>> samples(2, std::vector<double>(mechanism.reactions.size(), 1.0));
+    for (size_t i = 0; i < mechanism.reactions.size(); i++) {
+        samples[1][i] = (i % 2 ? -1.0 : 1.0) / (1.0 + i);
+    }
+
+    DRGReduction drg(std::make_shared<const ChemistryVars::MechanismData>(mechanism));
+    DRGReduction::Options options;
+    for (const auto& sp : ReactionIndex::parseEquation(mechanism.reactions.front().equation).reactants) {
+        options.targets.push_back(sp.first);
+    }
+
+    std::vector<double> serial = drg.interactionCoefficients(samples, 1);
+    std::vector<double> threaded = drg.interactionCoefficients(samples, 2);
+
+    options.threshold = 1.0;
+    DRGReduction::Result minimal = drg.reduce(samples, options);
+    options.threshold = 0.0;
+    DRGReduction::Result connected = drg.reduce(samples, options);
+
+    results.totalTests++;
+    bool passed = serial == threaded &&
+        minimal.retainedSpecies.size() == options.targets.size() &&
+        connected.retainedSpecies.size() >= minimal.retainedSpecies.size() &&
+        connected.mechanism.reactions.size() > 0;
+    for (double r : serial) {
+        if (r < 0.0 || r > 1.0 + 1e-12) passed = false;
+    }
+
+    if (passed) {
+        results.passedTests++;
+        std::cout << " DRG graph: " << drg.nEdges() << " edges, threshold 0 keeps "
+            << connected.retainedSpecies.size() << " species and "
+            << connected.mechanism.reactions.size() << " reactions" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("DRG reduction mismatch");
+        std::cout << " DRG reduction mismatch" << std::endl;
+    }
+
+    // The exported reduced mechanism reloads with the same species, reactions and units,
+    // and its third-body efficiencies only name declared species
+    results.totalTests++;
+    options.threshold = 0.2;
+    const std::string file = "drg_roundtrip.yaml";
+    DRGReduction::Result reduced = drg.reduceToYaml(samples, options, file);
+    ChemistryVars::MechanismData reloaded = ChemistryVars::loadMechanism(file);
+    std::remove(file.c_str());
+    passed = reloaded.thermoSpecies.size() == reduced.mechanism.thermoSpecies.size() &&
+        reloaded.reactions.size() == reduced.mechanism.reactions.size() &&
+        reloaded.units == mechanism.units;
+    std::set<std::string> declared;
+    for (const auto& sp : reloaded.thermoSpecies) declared.insert(sp.name);
+    size_t nEfficiencies = 0;
+    for (const auto& reaction : reloaded.reactions) {
+        for (const auto& eff : reaction.efficiencies) {
+            passed = passed && declared.count(eff.first) > 0;
+            nEfficiencies++;
+        }
+    }
+    if (passed) {
+        results.passedTests++;
+        std::cout << " Reduced mechanism round trip: " << reloaded.thermoSpecies.size() << " species, "
+            << reloaded.reactions.size() << " reactions, " << nEfficiencies << " efficiencies" << std::endl;
+    }
+    else {
+        results.failureMessages.push_back("Reduced mechanism YAML round trip mismatch");
+        std::cout << " Reduced mechanism YAML round trip mismatch" << std::endl;
     }
 }
 
@@ -578,7 +2284,30 @@ bool runMechanismTest(const std::string& yamlFile) {
 
         // Run tests
         testThermo(mechanism, results);
+        testThermoKernels(mechanism, results);
+        testNasa9(mechanism, results);
+        testThermoTable(mechanism, results);
+        testBatch(mechanism, results);
+        testSharedThermo(mechanism, results);
+        testThermoDerivatives(mechanism, results);
+        testStateInversion(mechanism, results);
+        testBatchInversion(mechanism, results);
+        testEquilibrium(mechanism, results);
+        testEquilibriumTable(mechanism, results);
+        testPrecision(mechanism, results);
+        testThermoCodegen(mechanism, results);
+        testStateCache(mechanism, results);
+        testPropertyBundle(mechanism, results);
+        testSpeciesProperties(mechanism, results);
         testReactions(mechanism, results);
+        testDuplicates(mechanism, results);
+        testElements(mechanism, results);
+        testCompact(mechanism, results);
+        testAnalytics(mechanism, results);
+        testReactionPaths(mechanism, results);
+        testViews(mechanism, results);
+        testMerge(mechanism, results);
+        testReduction(mechanism, results);
         testTransport(mechanism, results);
 
         // Print test result summary
@@ -0,0 +1,203 @@
+#include "MechanismView.h"
+#include "ReactionIndex.h"
+#include <stdexcept>
+
+// Source 实现
+
+MechanismView::Source::Source(ChemistryVars::MechanismData&& mechanism)
+    : Source(std::make_shared<const ChemistryVars::MechanismData>(std::move(mechanism))) {
+}
+
+std::shared_ptr<const MechanismView::Source> MechanismView::Source::copyOf(
+    const ChemistryVars::MechanismData& mechanism) {
+    return std::make_shared<const Source>(std::make_shared<const ChemistryVars::MechanismData>(mechanism));
+}
+
+MechanismView::Source::Source(std::shared_ptr<const ChemistryVars::MechanismData> mechanismPtr)
+    : m_mechanism(std::move(mechanismPtr)) {
+    if (!m_mechanism) throw std::invalid_argument("MechanismView::Source: null mechanism");
+    const ChemistryVars::MechanismData& mechanism = *m_mechanism;
+    const auto& species = mechanism.thermoSpecies;
+    m_speciesIndex.reserve(species.size());
+    for (size_t k = 0; k < species.size(); ++k) {
+        m_speciesIndex.emplace(species[k].name, k);
+    }
+
+    m_transportOf.assign(species.size(), std::string::npos);
+    for (size_t t = 0; t < mechanism.transportSpecies.size(); ++t) {
+        size_t k = speciesIndex(mechanism.transportSpecies[t].name);
+        if (k != std::string::npos) m_transportOf[k] = t;
+    }
+
+    // 每个反应只解析一次方程式
+    m_rxnStart.reserve(mechanism.reactions.size() + 1);
+    m_rxnStart.push_back(0);
+    for (const auto& reaction : mechanism.reactions) {
+        ReactionIndex::Stoichiometry st = ReactionIndex::parseEquation(reaction.equation);
+        for (const auto& sp : st.reactants) m_rxnSpecies.push_back(speciesIndex(sp.first));
+        for (const auto& sp : st.products) m_rxnSpecies.push_back(speciesIndex(sp.first));
+
+        // 指定碰撞体 "(+AR)" 也必须在子集中
+        if (st.thirdBody.size() > 3 && st.thirdBody != "(+M)") {
+            m_rxnSpecies.push_back(speciesIndex(st.thirdBody.substr(2, st.thirdBody.size() - 3)));
+        }
+        m_rxnStart.push_back(m_rxnSpecies.size());
+    }
+}
+
+size_t MechanismView::Source::speciesIndex(const std::string& name) const {
+    auto it = m_speciesIndex.find(name);
+    return it != m_speciesIndex.end() ? it->second : std::string::npos;
+}
+
+// MechanismView 实现
+
+MechanismView::MechanismView(std::shared_ptr<const Source> source)
+    : m_source(std::move(source)) {
+    if (!m_source) throw std::invalid_argument("MechanismView: null source");
+
+    size_t nsp = m_source->nSpecies();
+    size_t nrxn = m_source->nReactions();
+    m_species.resize(nsp);
+    m_localOf.resize(nsp);
+    for (size_t k = 0; k < nsp; ++k) {
+        m_species[k] = k;
+        m_localOf[k] = k;
+    }
+    m_reactions.resize(nrxn);
+    for (size_t i = 0; i < nrxn; ++i) {
+        m_reactions[i] = i;
+    }
+}
+
+MechanismView MechanismView::fromMask(std::shared_ptr<const Source> source, const std::vector<bool>& keep) {
+    if (!source) throw std::invalid_argument("MechanismView: null source");
+    if (keep.size() != source->nSpecies()) {
+        throw std::invalid_argument("MechanismView: species mask size mismatch");
+    }
+
+    MechanismView view;
+    view.m_source = std::move(source);
+    view.build(keep);
+    return view;
+}
+
+MechanismView MechanismView::withSpecies(std::shared_ptr<const Source> source,
+    const std::vector<std::string>& species) {
+    if (!source) throw std::invalid_argument("MechanismView: null source");
+
+    std::vector<bool> keep(source->nSpecies(), false);
+    for (const auto& name : species) {
+        size_t k = source->speciesIndex(name);
+        if (k == std::string::npos) {
+            throw std::invalid_argument("MechanismView: unknown species '" + name + "'");
+        }
+        keep[k] = true;
+    }
+    return fromMask(std::move(source), keep);
+}
+
+MechanismView MechanismView::withoutElements(std::shared_ptr<const Source> source,
+    const std::vector<std::string>& elements, const std::vector<std::string>& keepSpecies) {
+    if (!source) throw std::invalid_argument("MechanismView: null source");
+
+    const auto& species = source->mechanism().thermoSpecies;
+    std::vector<bool> keep(species.size(), true);
+    for (size_t k = 0; k < species.size(); ++k) {
+        for (const auto& elem : elements) {
+            auto it = species[k].composition.find(elem);
+            if (it != species[k].composition.end() && it->second != 0.0) {
+                keep[k] = false;
+                break;
+            }
+        }
+    }
+    for (const auto& name : keepSpecies) {
+        size_t k = source->speciesIndex(name);
+        if (k != std::string::npos) keep[k] = true;
+    }
+    return fromMask(std::move(source), keep);
+}
+
+MechanismView MechanismView::subset(const std::vector<bool>& keep) const {
+    if (keep.size() != nSpecies()) {
+        throw std::invalid_argument("MechanismView: species mask size mismatch");
+    }
+
+    std::vector<bool> parentMask(m_source->nSpecies(), false);
+    for (size_t k = 0; k < keep.size(); ++k) {
+        if (keep[k]) parentMask[m_species[k]] = true;
+    }
+
+    MechanismView view;
+    view.m_source = m_source;
+    view.build(parentMask);
+    return view;
+}
+
+void MechanismView::build(const std::vector<bool>& parentMask) {
+    const Source& src = *m_source;
+    size_t nsp = src.nSpecies();
+
+    m_species.clear();
+    m_localOf.assign(nsp, std::string::npos);
+    for (size_t k = 0; k < nsp; ++k) {
+        if (parentMask[k]) {
+            m_localOf[k] = m_species.size();
+            m_species.push_back(k);
+        }
+    }
+
+    // 反应封闭: 所有参与组分都在子集中
+    m_reactions.clear();
+    for (size_t i = 0; i < src.nReactions(); ++i) {
+        bool closed = true;
+        for (const size_t* p = src.reactionSpeciesBegin(i); p != src.reactionSpeciesEnd(i); ++p) {
+            if (*p == std::string::npos || !parentMask[*p]) {
+                closed = false;
+                break;
+            }
+        }
+        if (closed) m_reactions.push_back(i);
+    }
+}
+
+size_t MechanismView::speciesIndex(const std::string& name) const {
+    size_t k = m_source->speciesIndex(name);
+    return k != std::string::npos ? m_localOf[k] : std::string::npos;
+}
+
+const ChemistryVars::ThermoData& MechanismView::thermo(size_t k) const {
+    return m_source->mechanism().thermoSpecies[m_species[k]];
+}
+
+const ChemistryVars::TransportData* MechanismView::transport(size_t k) const {
+    size_t t = m_source->transportIndex(m_species[k]);
+    return t != std::string::npos ? &m_source->mechanism().transportSpecies[t] : nullptr;
+}
+
+const ChemistryVars::ReactionData& MechanismView::reaction(size_t i) const {
+    return m_source->mechanism().reactions[m_reactions[i]];
+}
+
+ChemistryVars::MechanismData MechanismView::materialize() const {
+    ChemistryVars::MechanismData result;
+    result.units = m_source->mechanism().units;
+    result.thermoSpecies.reserve(nSpecies());
+    for (size_t k = 0; k < nSpecies(); ++k) {
+        result.thermoSpecies.push_back(thermo(k));
+        const ChemistryVars::TransportData* tr = transport(k);
+        if (tr) result.transportSpecies.push_back(*tr);
+    }
+    result.reactions.reserve(nReactions());
+    for (size_t i = 0; i < nReactions(); ++i) {
+        result.reactions.push_back(reaction(i));
+        // 第三体效率中不在视图中的组分去掉 (导出的机理不能引用未声明的组分)
+        auto& efficiencies = result.reactions.back().efficiencies;
+        for (auto it = efficiencies.begin(); it != efficiencies.end();) {
+            if (speciesIndex(it->first) == std::string::npos) it = efficiencies.erase(it);
+            else ++it;
+        }
+    }
+    return result;
+}
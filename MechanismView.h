@@ -0,0 +1,94 @@
+#pragma once
+#include "ChemistryVars.h"
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// 子机理视图 - 组分子集及其封闭的反应集合, 只保存指向父机理的索引, 不复制数据
+// 父机理的预处理结构(Source)只建立一次, 之后为每个工况建立视图的代价为O(反应参与组分数)
+class MechanismView {
+public:
+    // 父机理及其预处理结构, 多个视图共享
+    // Source共同拥有父机理 (shared_ptr), 视图通过Source保持父机理有效, 不会悬空
+    class Source {
+    public:
+        // 与调用者共享父机理, 不复制; 为空时抛出 std::invalid_argument
+        explicit Source(std::shared_ptr<const ChemistryVars::MechanismData> mechanism);
+        // 移入父机理
+        explicit Source(ChemistryVars::MechanismData&& mechanism);
+        // 复制父机理 (调用者不能提供shared_ptr时显式使用, 内存加倍)
+        static std::shared_ptr<const Source> copyOf(const ChemistryVars::MechanismData& mechanism);
+
+        const ChemistryVars::MechanismData& mechanism() const { return *m_mechanism; }
+        const std::shared_ptr<const ChemistryVars::MechanismData>& mechanismPtr() const { return m_mechanism; }
+        size_t nSpecies() const { return m_mechanism->thermoSpecies.size(); }
+        size_t nReactions() const { return m_mechanism->reactions.size(); }
+
+        // 组分名 -> 父机理组分索引 (未找到返回npos)
+        size_t speciesIndex(const std::string& name) const;
+        // 父机理组分索引 -> transportSpecies索引 (无输运数据返回npos)
+        size_t transportIndex(size_t k) const { return m_transportOf[k]; }
+
+        // 反应i参与的组分(反应物、产物及指定碰撞体), CSR格式
+        const size_t* reactionSpeciesBegin(size_t i) const { return m_rxnSpecies.data() + m_rxnStart[i]; }
+        const size_t* reactionSpeciesEnd(size_t i) const { return m_rxnSpecies.data() + m_rxnStart[i + 1]; }
+
+    private:
+        std::shared_ptr<const ChemistryVars::MechanismData> m_mechanism;
+        std::unordered_map<std::string, size_t> m_speciesIndex;
+        std::vector<size_t> m_transportOf;
+        std::vector<size_t> m_rxnStart;
+        std::vector<size_t> m_rxnSpecies;       // 未知组分记为npos, 该反应不会出现在任何子集视图中
+    };
+
+    // 完整视图 (全部组分和反应)
+    explicit MechanismView(std::shared_ptr<const Source> source);
+
+    // 由组分掩码建立视图, 反应须所有参与组分都在子集中
+    static MechanismView fromMask(std::shared_ptr<const Source> source, const std::vector<bool>& keep);
+    // 只保留指定组分
+    static MechanismView withSpecies(std::shared_ptr<const Source> source, const std::vector<std::string>& species);
+    // 去掉含有指定元素的组分 (如去掉氮化学), keepSpecies中的组分例外保留 (如惰性N2)
+    static MechanismView withoutElements(std::shared_ptr<const Source> source,
+        const std::vector<std::string>& elements,
+        const std::vector<std::string>& keepSpecies = std::vector<std::string>());
+
+    // 在当前视图基础上进一步缩小 (keep按视图内组分索引)
+    MechanismView subset(const std::vector<bool>& keep) const;
+
+    // 视图大小
+    size_t nSpecies() const { return m_species.size(); }
+    size_t nReactions() const { return m_reactions.size(); }
+
+    // 视图索引 -> 父机理索引
+    size_t parentSpecies(size_t k) const { return m_species[k]; }
+    size_t parentReaction(size_t i) const { return m_reactions[i]; }
+    const std::vector<size_t>& speciesIndices() const { return m_species; }
+    const std::vector<size_t>& reactionIndices() const { return m_reactions; }
+
+    // 父机理组分索引 -> 视图索引 (不在视图中返回npos)
+    size_t localSpecies(size_t parentIndex) const { return m_localOf[parentIndex]; }
+    size_t speciesIndex(const std::string& name) const;
+
+    // 数据访问 (直接引用父机理)
+    const std::string& speciesName(size_t k) const { return thermo(k).name; }
+    const ChemistryVars::ThermoData& thermo(size_t k) const;
+    const ChemistryVars::TransportData* transport(size_t k) const;
+    const ChemistryVars::ReactionData& reaction(size_t i) const;
+
+    const Source& source() const { return *m_source; }
+    const std::shared_ptr<const Source>& sourcePtr() const { return m_source; }
+
+    // 需要独立副本时(例如导出)才复制数据; 第三体效率只保留视图中的组分
+    ChemistryVars::MechanismData materialize() const;
+
+private:
+    MechanismView() = default;
+    void build(const std::vector<bool>& parentMask);
+
+    std::shared_ptr<const Source> m_source;
+    std::vector<size_t> m_species;      // 视图组分 -> 父机理组分
+    std::vector<size_t> m_reactions;    // 视图反应 -> 父机理反应
+    std::vector<size_t> m_localOf;      // 父机理组分 -> 视图组分
+};
@@ -0,0 +1,185 @@
+#include "ReactionGraph.h"
+#include "ReactionIndex.h"
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+// ReactionGraph 实现
+
+ReactionGraph::ReactionGraph(const ChemistryVars::MechanismData& mechanism)
+    : m_elements(mechanism.thermoSpecies) {
+    size_t nsp = mechanism.thermoSpecies.size();
+    std::unordered_map<std::string, size_t> speciesIndex;
+    speciesIndex.reserve(nsp);
+    for (size_t k = 0; k < nsp; ++k) {
+        speciesIndex.emplace(mechanism.thermoSpecies[k].name, k);
+    }
+
+    // 反应 -> 组分 (方程式中未定义的组分忽略)
+    m_rxnStart.reserve(mechanism.reactions.size() + 1);
+    m_rxnStart.push_back(0);
+    for (const auto& reaction : mechanism.reactions) {
+        ReactionIndex::Stoichiometry st = ReactionIndex::parseEquation(reaction.equation);
+        size_t begin = m_rxnSpecies.size();
+        for (int side = 0; side < 2; ++side) {
+            for (const auto& sp : side == 0 ? st.reactants : st.products) {
+                auto it = speciesIndex.find(sp.first);
+                if (it == speciesIndex.end()) continue;
+
+                size_t j = begin;
+                while (j < m_rxnSpecies.size() && m_rxnSpecies[j] != it->second) ++j;
+                if (j == m_rxnSpecies.size()) {
+                    m_rxnSpecies.push_back(it->second);
+                    m_rxnReactant.push_back(0.0);
+                    m_rxnProduct.push_back(0.0);
+                }
+                (side == 0 ? m_rxnReactant[j] : m_rxnProduct[j]) += sp.second;
+            }
+        }
+        m_rxnStart.push_back(m_rxnSpecies.size());
+    }
+
+    // 转置: 组分 -> 反应
+    m_spStart.assign(nsp + 1, 0);
+    for (size_t k : m_rxnSpecies) m_spStart[k + 1]++;
+    for (size_t k = 0; k < nsp; ++k) m_spStart[k + 1] += m_spStart[k];
+
+    m_spReaction.resize(m_rxnSpecies.size());
+    m_spNet.resize(m_rxnSpecies.size());
+    std::vector<size_t> fill(m_spStart.begin(), m_spStart.end() - 1);
+    for (size_t i = 0; i + 1 < m_rxnStart.size(); ++i) {
+        for (size_t j = m_rxnStart[i]; j < m_rxnStart[i + 1]; ++j) {
+            size_t slot = fill[m_rxnSpecies[j]]++;
+            m_spReaction[slot] = i;
+            m_spNet[slot] = m_rxnProduct[j] - m_rxnReactant[j];
+        }
+    }
+}
+
+void ReactionGraph::getNetProductionRates(const double* netRates, double* wdot) const {
+    for (size_t k = 0; k < nSpecies(); ++k) {
+        double sum = 0.0;
+        for (size_t j = m_spStart[k]; j < m_spStart[k + 1]; ++j) {
+            sum += m_spNet[j] * netRates[m_spReaction[j]];
+        }
+        wdot[k] = sum;
+    }
+}
+
+// ElementFlux 实现
+
+ElementFlux::ElementFlux(const ReactionGraph& graph, const std::string& element)
+    : m_element(element), m_nSpecies(graph.nSpecies()) {
+    const ElementTable& elements = graph.elements();
+    size_t m = elements.elementIndex(element);
+    if (m == std::string::npos) {
+        throw std::invalid_argument("ElementFlux: element '" + element + "' not in mechanism");
+    }
+
+    // 第一遍: 每个反应的 (A, B, 权重)
+    struct Pair {
+        size_t A;
+        size_t B;
+        double weight;
+    };
+    std::vector<std::vector<Pair>> pairs(graph.nReactions());
+    std::vector<std::pair<size_t, size_t>> edges;
+    for (size_t i = 0; i < graph.nReactions(); ++i) {
+        double total = 0.0;
+        for (size_t j = graph.reactionBegin(i); j < graph.reactionEnd(i); ++j) {
+            total += graph.reactantCoeff(j) * elements.nAtoms(graph.reactionSpecies(j), m);
+        }
+        if (total <= 0.0) continue;
+
+        for (size_t a = graph.reactionBegin(i); a < graph.reactionEnd(i); ++a) {
+            size_t A = graph.reactionSpecies(a);
+            double fromA = graph.reactantCoeff(a) * elements.nAtoms(A, m);
+            if (fromA == 0.0) continue;
+            for (size_t b = graph.reactionBegin(i); b < graph.reactionEnd(i); ++b) {
+                size_t B = graph.reactionSpecies(b);
+                double toB = graph.productCoeff(b) * elements.nAtoms(B, m);
+                if (toB == 0.0 || A == B) continue;
+                pairs[i].push_back({ A, B, fromA * toB / total });
+                edges.push_back(std::make_pair(A, B));
+                edges.push_back(std::make_pair(B, A));
+            }
+        }
+    }
+
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+    m_source.reserve(edges.size());
+    m_target.reserve(edges.size());
+    m_edgeStart.assign(m_nSpecies + 1, 0);
+    for (const auto& e : edges) {
+        m_source.push_back(e.first);
+        m_target.push_back(e.second);
+        m_edgeStart[e.first + 1]++;
+    }
+    for (size_t k = 0; k < m_nSpecies; ++k) m_edgeStart[k + 1] += m_edgeStart[k];
+
+    // 第二遍: 贡献项直接保存边索引
+    m_termStart.reserve(graph.nReactions() + 1);
+    m_termStart.push_back(0);
+    for (size_t i = 0; i < graph.nReactions(); ++i) {
+        for (const Pair& p : pairs[i]) {
+            m_terms.push_back({ edgeIndex(p.A, p.B), edgeIndex(p.B, p.A), p.weight });
+        }
+        m_termStart.push_back(m_terms.size());
+    }
+}
+
+size_t ElementFlux::edgeIndex(size_t A, size_t B) const {
+    auto first = m_target.begin() + m_edgeStart[A];
+    auto last = m_target.begin() + m_edgeStart[A + 1];
+    auto it = std::lower_bound(first, last, B);
+    return (it != last && *it == B) ? static_cast<size_t>(it - m_target.begin()) : std::string::npos;
+}
+
+void ElementFlux::compute(const double* netRates, double* flux) const {
+    std::fill(flux, flux + nEdges(), 0.0);
+    for (size_t i = 0; i < nReactions(); ++i) {
+        double q = netRates[i];
+        if (q == 0.0) continue;
+        for (size_t t = m_termStart[i]; t < m_termStart[i + 1]; ++t) {
+            const Term& term = m_terms[t];
+            if (q > 0.0) flux[term.forward] += q * term.weight;
+            else flux[term.reverse] -= q * term.weight;
+        }
+    }
+}
+
+void ElementFlux::compute(const double* forwardRates, const double* reverseRates, double* flux) const {
+    std::fill(flux, flux + nEdges(), 0.0);
+    for (size_t i = 0; i < nReactions(); ++i) {
+        double qf = forwardRates[i];
+        double qr = reverseRates[i];
+        for (size_t t = m_termStart[i]; t < m_termStart[i + 1]; ++t) {
+            const Term& term = m_terms[t];
+            flux[term.forward] += qf * term.weight;
+            flux[term.reverse] += qr * term.weight;
+        }
+    }
+}
+
+void ElementFlux::computeBatch(const double* netRates, size_t nSnapshots, double* fluxes) const {
+    for (size_t s = 0; s < nSnapshots; ++s) {
+        compute(netRates + s * nReactions(), fluxes + s * nEdges());
+    }
+}
+
+std::vector<double> ElementFlux::compute(const std::vector<double>& netRates) const {
+    if (netRates.size() != nReactions()) {
+        throw std::invalid_argument("ElementFlux: rate array size does not match number of reactions");
+    }
+    std::vector<double> flux(nEdges());
+    compute(netRates.data(), flux.data());
+    return flux;
+}
+
+double ElementFlux::netFlux(const double* flux, size_t A, size_t B) const {
+    size_t forward = edgeIndex(A, B);
+    if (forward == std::string::npos) return 0.0;
+    return flux[forward] - flux[edgeIndex(B, A)];
+}
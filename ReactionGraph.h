@@ -0,0 +1,91 @@
+#pragma once
+#include "ChemistryVars.h"
+#include "ElementTable.h"
+#include <string>
+#include <vector>
+
+// 组分-反应二部图 - 由化学计量式建立, 两个方向均为CSR格式
+// 建立一次后可用于大量快照的后处理 (生成速率、反应路径), 不再解析方程式
+class ReactionGraph {
+public:
+    explicit ReactionGraph(const ChemistryVars::MechanismData& mechanism);
+
+    size_t nSpecies() const { return m_elements.nSpecies(); }
+    size_t nReactions() const { return m_rxnStart.size() - 1; }
+    const ElementTable& elements() const { return m_elements; }
+
+    // 反应i -> 参与组分 (反应物和产物合并, 每个组分只出现一次)
+    size_t reactionBegin(size_t i) const { return m_rxnStart[i]; }
+    size_t reactionEnd(size_t i) const { return m_rxnStart[i + 1]; }
+    size_t reactionSpecies(size_t j) const { return m_rxnSpecies[j]; }
+    double reactantCoeff(size_t j) const { return m_rxnReactant[j]; }
+    double productCoeff(size_t j) const { return m_rxnProduct[j]; }
+
+    // 组分k -> 参与的反应及净化学计量系数 (产物 - 反应物)
+    size_t speciesBegin(size_t k) const { return m_spStart[k]; }
+    size_t speciesEnd(size_t k) const { return m_spStart[k + 1]; }
+    size_t speciesReaction(size_t j) const { return m_spReaction[j]; }
+    double speciesNetCoeff(size_t j) const { return m_spNet[j]; }
+
+    // 净生成速率 wdot_k = sum_i nu_ki * q_i (netRates长度为nReactions, wdot长度为nSpecies)
+    void getNetProductionRates(const double* netRates, double* wdot) const;
+
+private:
+    ElementTable m_elements;
+
+    std::vector<size_t> m_rxnStart;
+    std::vector<size_t> m_rxnSpecies;
+    std::vector<double> m_rxnReactant;
+    std::vector<double> m_rxnProduct;
+
+    std::vector<size_t> m_spStart;
+    std::vector<size_t> m_spReaction;
+    std::vector<double> m_spNet;
+};
+
+// 元素通量反应路径分析
+// 反应i中元素E从反应物A流向产物B的通量: q_i * (n_A,E * nu'_A) * (n_B,E * nu''_B) / N_E,i
+// N_E,i 为反应物一侧E的原子总数; q_i < 0 时通量方向相反
+class ElementFlux {
+public:
+    ElementFlux(const ReactionGraph& graph, const std::string& element);
+
+    const std::string& element() const { return m_element; }
+    size_t nSpecies() const { return m_nSpecies; }
+    size_t nReactions() const { return m_termStart.size() - 1; }
+
+    // 有向边 (A->B), 每条边的两个方向都单独列出
+    size_t nEdges() const { return m_source.size(); }
+    size_t edgeSource(size_t e) const { return m_source[e]; }
+    size_t edgeTarget(size_t e) const { return m_target[e]; }
+    // 边(A->B)的索引, 不存在返回npos
+    size_t edgeIndex(size_t A, size_t B) const;
+
+    // 由净反应进度计算各边的通量 (flux长度为nEdges)
+    void compute(const double* netRates, double* flux) const;
+    // 正、逆反应进度分别给出 (flux只累加各自方向的贡献)
+    void compute(const double* forwardRates, const double* reverseRates, double* flux) const;
+    // 批量快照: netRates为 nSnapshots×nReactions, fluxes为 nSnapshots×nEdges (行主序)
+    void computeBatch(const double* netRates, size_t nSnapshots, double* fluxes) const;
+    std::vector<double> compute(const std::vector<double>& netRates) const;
+
+    // 净通量 A->B (正向减反向)
+    double netFlux(const double* flux, size_t A, size_t B) const;
+
+private:
+    // 反应i的一项贡献: q_i>0 时加到forward边, q_i<0 时加到reverse边
+    struct Term {
+        size_t forward;
+        size_t reverse;
+        double weight;
+    };
+
+    std::string m_element;
+    size_t m_nSpecies;
+    std::vector<size_t> m_termStart;
+    std::vector<Term> m_terms;
+
+    std::vector<size_t> m_source;
+    std::vector<size_t> m_target;
+    std::vector<size_t> m_edgeStart;    // 源组分 -> 边 (CSR, 目标组分有序)
+};
@@ -0,0 +1,246 @@
+#include "ReactionIndex.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+
+namespace {
+
+// 去除首尾空白
+std::string trim(const std::string& s) {
+    size_t b = s.find_first_not_of(" \t\r\n");
+    if (b == std::string::npos) return std::string();
+    size_t e = s.find_last_not_of(" \t\r\n");
+    return s.substr(b, e - b + 1);
+}
+
+// 整个token是否为数字 (化学计量系数)
+bool parseCoefficient(const std::string& token, double& value) {
+    if (token.empty() || !(isdigit(static_cast<unsigned char>(token[0])) || token[0] == '.')) {
+        return false;
+    }
+    char* end = nullptr;
+    value = std::strtod(token.c_str(), &end);
+    return end && *end == '\0';
+}
+
+// 解析方程式的一侧, 返回排好序并合并后的组分列表
+void parseSide(std::string side, std::vector<std::pair<std::string, double>>& species,
+    std::string& thirdBody) {
+    // falloff碰撞体 "(+M)" / "(+ AR)"
+    size_t open = side.find("(+");
+    if (open != std::string::npos) {
+        size_t close = side.find(')', open);
+        if (close != std::string::npos) {
+            thirdBody = "(+" + trim(side.substr(open + 2, close - open - 2)) + ")";
+            side.erase(open, close - open + 1);
+        }
+    }
+
+    std::istringstream ss(side);
+    std::string token;
+    double stoich = 1.0;
+    while (ss >> token) {
+        if (token == "+") continue;
+
+        double value = 0.0;
+        if (parseCoefficient(token, value)) {
+            stoich = value;
+            continue;
+        }
+        if (token == "M") {
+            thirdBody = "M";
+            stoich = 1.0;
+            continue;
+        }
+        species.emplace_back(token, stoich);
+        stoich = 1.0;
+    }
+
+    // 排序并合并同名组分 ("H + H" 与 "2 H" 等价)
+    std::sort(species.begin(), species.end());
+    std::vector<std::pair<std::string, double>> merged;
+    for (const auto& sp : species) {
+        if (!merged.empty() && merged.back().first == sp.first) {
+            merged.back().second += sp.second;
+        } else {
+            merged.push_back(sp);
+        }
+    }
+    species.swap(merged);
+}
+
+std::string sideKey(const std::vector<std::pair<std::string, double>>& species) {
+    std::string key;
+    char buf[32];
+    for (const auto& sp : species) {
+        if (!key.empty()) key += " + ";
+        if (sp.second != 1.0) {
+            std::snprintf(buf, sizeof(buf), "%.8g ", sp.second);
+            key += buf;
+        }
+        key += sp.first;
+    }
+    return key;
+}
+
+const std::vector<size_t> kEmpty;
+
+} // namespace
+
+ReactionIndex::ReactionIndex(const std::vector<ChemistryVars::ReactionData>& reactions) {
+    build(reactions);
+}
+
+void ReactionIndex::build(const std::vector<ChemistryVars::ReactionData>& reactions) {
+    m_stoich.clear();
+    m_groupOf.clear();
+    m_forward.clear();
+    m_flagged.clear();
+    m_groups.clear();
+    m_lookup.clear();
+
+    m_stoich.reserve(reactions.size());
+    m_groupOf.reserve(reactions.size());
+    m_forward.reserve(reactions.size());
+    m_flagged.reserve(reactions.size());
+    m_lookup.reserve(reactions.size());
+
+    for (size_t i = 0; i < reactions.size(); ++i) {
+        m_stoich.push_back(parseEquation(reactions[i].equation));
+        const Stoichiometry& st = m_stoich.back();
+        std::string key = canonicalKey(st);
+        uint64_t h = hashKey(key);
+
+        size_t group = std::string::npos;
+        auto range = m_lookup.equal_range(h);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (m_groups[it->second].key == key) {
+                group = it->second;
+                break;
+            }
+        }
+        if (group == std::string::npos) {
+            group = m_groups.size();
+            m_groups.push_back(Group{ key, {} });
+            m_lookup.emplace(h, group);
+        }
+
+        m_groups[group].reactions.push_back(i);
+        m_groupOf.push_back(group);
+        m_forward.push_back(reactantsFirst(st));
+        m_flagged.push_back(reactions[i].isDuplicate);
+    }
+}
+
+const std::vector<size_t>& ReactionIndex::find(const std::string& equation) const {
+    return findKey(canonicalKey(equation));
+}
+
+const std::vector<size_t>& ReactionIndex::findKey(const std::string& key) const {
+    auto range = m_lookup.equal_range(hashKey(key));
+    for (auto it = range.first; it != range.second; ++it) {
+        if (m_groups[it->second].key == key) {
+            return m_groups[it->second].reactions;
+        }
+    }
+    return kEmpty;
+}
+
+std::vector<ReactionIndex::DuplicateIssue> ReactionIndex::checkDuplicates() const {
+    std::vector<DuplicateIssue> issues;
+    std::vector<bool> hasPartner(m_stoich.size(), false);
+
+    // 只需检查同一分组内的反应, 分组通常只有1-2个成员
+    for (const auto& group : m_groups) {
+        const auto& members = group.reactions;
+        for (size_t a = 0; a < members.size(); ++a) {
+            for (size_t b = a + 1; b < members.size(); ++b) {
+                size_t i = members[a];
+                size_t j = members[b];
+
+                // 方向相反的两个不可逆反应不算重复
+                if (!m_stoich[i].reversible && !m_stoich[j].reversible &&
+                    m_forward[i] != m_forward[j]) {
+                    continue;
+                }
+
+                hasPartner[i] = true;
+                hasPartner[j] = true;
+                if (!m_flagged[i] || !m_flagged[j]) {
+                    size_t bad = m_flagged[i] ? j : i;
+                    size_t other = (bad == i) ? j : i;
+                    issues.push_back({ DuplicateIssue::Kind::Undeclared, bad, other, group.key });
+                }
+            }
+        }
+    }
+
+    for (size_t i = 0; i < m_stoich.size(); ++i) {
+        if (m_flagged[i] && !hasPartner[i]) {
+            issues.push_back({ DuplicateIssue::Kind::MissingPartner, i, std::string::npos,
+                m_groups[m_groupOf[i]].key });
+        }
+    }
+
+    return issues;
+}
+
+ReactionIndex::Stoichiometry ReactionIndex::parseEquation(const std::string& equation) {
+    Stoichiometry st;
+
+    // 定位反应箭头
+    size_t arrowPos = equation.find("<=>");
+    size_t arrowLen = 3;
+    if (arrowPos == std::string::npos) {
+        arrowPos = equation.find("=>");
+        arrowLen = 2;
+        st.reversible = false;
+        if (arrowPos == std::string::npos) {
+            arrowPos = equation.find('=');
+            arrowLen = 1;
+            st.reversible = true;
+        }
+    }
+    if (arrowPos == std::string::npos) return st;   // 未找到反应箭头
+
+    std::string lhsThird, rhsThird;
+    parseSide(equation.substr(0, arrowPos), st.reactants, lhsThird);
+    parseSide(equation.substr(arrowPos + arrowLen), st.products, rhsThird);
+    st.thirdBody = !lhsThird.empty() ? lhsThird : rhsThird;
+    return st;
+}
+
+bool ReactionIndex::reactantsFirst(const Stoichiometry& stoich) {
+    return !(stoich.products < stoich.reactants);
+}
+
+bool ReactionIndex::distinctDirections(const Stoichiometry& a, const Stoichiometry& b) {
+    return !a.reversible && !b.reversible && reactantsFirst(a) != reactantsFirst(b);
+}
+
+std::string ReactionIndex::canonicalKey(const Stoichiometry& stoich) {
+    std::string lhs = sideKey(stoich.reactants);
+    std::string rhs = sideKey(stoich.products);
+    if (!reactantsFirst(stoich)) std::swap(lhs, rhs);
+
+    std::string key = lhs + " <=> " + rhs;
+    if (!stoich.thirdBody.empty()) {
+        key += " | " + stoich.thirdBody;
+    }
+    return key;
+}
+
+std::string ReactionIndex::canonicalKey(const std::string& equation) {
+    return canonicalKey(parseEquation(equation));
+}
+
+uint64_t ReactionIndex::hashKey(const std::string& key) {
+    // 64位FNV-1a
+    uint64_t h = 14695981039346656037ULL;
+    for (unsigned char c : key) {
+        h ^= c;
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include "ChemistryVars.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// 反应索引 - 以规范化(与书写顺序无关)的化学计量式哈希为键
+// 支持按方程式O(1)查找, 以及全机理范围内的重复反应检查
+class ReactionIndex {
+public:
+    // 单个反应的化学计量信息 (组分按名称排序)
+    struct Stoichiometry {
+        std::vector<std::pair<std::string, double>> reactants;
+        std::vector<std::pair<std::string, double>> products;
+        bool reversible = true;
+        std::string thirdBody;      // "" / "M" (三体) / "(+M)" 或 "(+AR)" (falloff碰撞体)
+    };
+
+    // 重复反应检查结果
+    struct DuplicateIssue {
+        enum class Kind {
+            Undeclared,         // 化学计量相同但未标记duplicate
+            MissingPartner      // 标记了duplicate但找不到对应的重复反应
+        };
+        Kind kind;
+        size_t reaction;                // 出问题的反应索引
+        size_t other;                   // 对应的重复反应 (MissingPartner时为npos)
+        std::string equation;
+    };
+
+    ReactionIndex() = default;
+    explicit ReactionIndex(const std::vector<ChemistryVars::ReactionData>& reactions);
+
+    // 重新建立索引
+    void build(const std::vector<ChemistryVars::ReactionData>& reactions);
+
+    size_t nReactions() const { return m_stoich.size(); }
+
+    // 按方程式查找所有化学计量相同的反应 (未找到时返回空列表)
+    const std::vector<size_t>& find(const std::string& equation) const;
+    const std::vector<size_t>& findKey(const std::string& key) const;
+
+    // 已解析的化学计量式
+    const Stoichiometry& stoichiometry(size_t i) const { return m_stoich[i]; }
+    const std::string& key(size_t i) const { return m_groups[m_groupOf[i]].key; }
+
+    // 检查未声明的重复反应和不匹配的duplicate标记
+    std::vector<DuplicateIssue> checkDuplicates() const;
+
+    // 化学计量相同的两个反应是否可以同时存在而不构成重复 (方向相反的两个不可逆反应)
+    static bool distinctDirections(const Stoichiometry& a, const Stoichiometry& b);
+
+    // 工具函数
+    static Stoichiometry parseEquation(const std::string& equation);
+    static std::string canonicalKey(const Stoichiometry& stoich);
+    static std::string canonicalKey(const std::string& equation);
+    static uint64_t hashKey(const std::string& key);
+
+private:
+    struct Group {
+        std::string key;
+        std::vector<size_t> reactions;
+    };
+
+    // 反应物一侧在规范键中是否排在前面 (用于判断不可逆反应方向)
+    static bool reactantsFirst(const Stoichiometry& stoich);
+
+    std::vector<Stoichiometry> m_stoich;
+    std::vector<size_t> m_groupOf;          // 反应 -> 分组
+    std::vector<bool> m_forward;            // 反应物一侧是否为规范键的第一侧
+    std::vector<bool> m_flagged;            // 文件中的duplicate标记
+    std::vector<Group> m_groups;
+    std::unordered_multimap<uint64_t, size_t> m_lookup;    // 哈希 -> 分组
+};
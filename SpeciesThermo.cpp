@@ -0,0 +1,122 @@
+#include "SpeciesThermo.h"
+#include <algorithm>
+#include <limits>
+
+// ThermoWorkspace 实现
+
+void ThermoWorkspace::resize(size_t nSpecies) {
+    h_RT.resize(nSpecies);
+    s_R.resize(nSpecies);
+    cp_R.resize(nSpecies);
+    g_RT.resize(nSpecies);
+    dcp_R.resize(nSpecies);
+    invalidate();
+}
+
+// SpeciesThermo 实现
+
+SpeciesThermo::SpeciesThermo(std::vector<ChemistryVars::ThermoData> species)
+    : m_species(std::move(species)) {
+    // 元素表和组成矩阵每个机理只建立一次, 分子量为矩阵-向量乘积
+    m_elements = ElementTable(m_species);
+    m_molecularWeights = m_elements.molecularWeights();
+
+    // NASA7/NASA9系数表只在初始化时建立一次
+    m_nasa = Nasa7Table(m_species);
+    m_nasa9 = Nasa9Table(m_species);
+}
+
+std::vector<double> SpeciesThermo::breakpoints() const {
+    std::vector<double> result;
+    const double none = std::numeric_limits<double>::max();
+    for (size_t k = 0; k < m_nasa.nSpecies(); ++k) {
+        if (m_nasa.Tmid(k) < none) result.push_back(m_nasa.Tmid(k));
+    }
+    for (size_t j = 0; j < m_nasa9.nSpecies(); ++j) {
+        for (size_t r = 1; r < m_nasa9.nRanges(); ++r) {
+            if (m_nasa9.Tmin(j, r) < none) result.push_back(m_nasa9.Tmin(j, r));
+        }
+    }
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+void SpeciesThermo::evaluate(double T, double* h_RT, double* s_R, double* cp_R, ThermoWorkspace& work) const {
+    evaluate(T, h_RT, s_R, cp_R, nullptr, work);
+}
+
+void SpeciesThermo::evaluate(double T, double* h_RT, double* s_R, double* cp_R, double* dcp_R,
+    ThermoWorkspace& work) const {
+    if (m_nasa.nSpecies() > 0) {
+        ThermoKernels::evaluate(m_nasa, T, h_RT, s_R, cp_R, dcp_R);
+    }
+
+    // NASA9组分在表内连续计算后写回各自的位置
+    size_t n9 = m_nasa9.nSpecies();
+    if (n9 > 0) {
+        work.nasa9.resize(4 * n9);
+        double* h9 = work.nasa9.data();
+        double* s9 = h9 + n9;
+        double* cp9 = s9 + n9;
+        double* dcp9 = dcp_R ? cp9 + n9 : nullptr;
+        ThermoKernels::evaluate(m_nasa9, T, h9, s9, cp9, dcp9);
+        for (size_t j = 0; j < n9; ++j) {
+            size_t k = m_nasa9.speciesIndex(j);
+            h_RT[k] = h9[j];
+            s_R[k] = s9[j];
+            cp_R[k] = cp9[j];
+            if (dcp_R) dcp_R[k] = dcp9[j];
+        }
+    }
+}
+
+void SpeciesThermo::update(double T, ThermoWorkspace& work, const ThermoTable* table) const {
+    if (T == work.T) {
+        return; // 温度没有变化，不需要更新
+    }
+    work.T = T;
+    work.Tderiv = -1.0;
+
+    // 插值表覆盖当前温度时用插值, 否则用系数表精确计算; 都不分配内存
+    size_t n = std::min(nSpecies(), work.h_RT.size());
+    if (table && table->contains(T) && table->nSpecies() == nSpecies() && n == nSpecies()) {
+        table->evaluate(T, work.h_RT.data(), work.s_R.data(), work.cp_R.data());
+    }
+    else if (n == nSpecies()) {
+        evaluate(T, work.h_RT.data(), work.s_R.data(), work.cp_R.data(), work);
+    }
+
+    fillDefaults(n, work);
+}
+
+void SpeciesThermo::updateDerivatives(double T, ThermoWorkspace& work) const {
+    if (T == work.Tderiv) {
+        return;
+    }
+    work.T = T;
+    work.Tderiv = T;
+
+    size_t n = std::min(nSpecies(), work.h_RT.size());
+    if (n == nSpecies()) {
+        evaluate(T, work.h_RT.data(), work.s_R.data(), work.cp_R.data(), work.dcp_R.data(), work);
+    }
+    for (size_t i = n; i < work.dcp_R.size(); ++i) {
+        work.dcp_R[i] = 0.0;
+    }
+    fillDefaults(n, work);
+}
+
+void SpeciesThermo::fillDefaults(size_t first, ThermoWorkspace& work) const {
+    // 手动添加(没有热力学数据)的组分使用默认值
+    for (size_t i = first; i < work.h_RT.size(); ++i) {
+        work.h_RT[i] = 0.0;
+        work.s_R[i] = 0.0;
+        work.cp_R[i] = 3.5; // 双原子分子默认值
+    }
+
+    // 计算吉布斯自由能
+    for (size_t i = 0; i < work.h_RT.size(); ++i) {
+        work.g_RT[i] = work.h_RT[i] - work.s_R[i];
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include "ChemistryVars.h"
+#include "ElementTable.h"
+#include "ThermoKernels.h"
+#include "ThermoTable.h"
+#include <string>
+#include <vector>
+
+// 求值缓存 - 每个线程 (或每个相对象) 一份, 与共享的SpeciesThermo配合使用
+// 数组长度可以大于数据库的组分数, 多出的组分 (手动添加、没有热力学数据) 按 cp/R = 3.5 处理
+struct ThermoWorkspace {
+    std::vector<double> h_RT;                   // 无量纲参考焓
+    std::vector<double> s_R;                    // 无量纲参考熵
+    std::vector<double> cp_R;                   // 无量纲参考热容
+    std::vector<double> g_RT;                   // 无量纲参考吉布斯能
+    std::vector<double> dcp_R;                  // d(cp/R)/dT 1/K (只由updateDerivatives计算)
+    std::vector<double> nasa9;                  // NASA9内核输出 (h/RT, s/R, cp/R, d(cp/R)/dT 各nSpecies个)
+    double T = -1.0;                            // 上述数组对应的温度, 小于0表示需要重新计算
+    double Tderiv = -1.0;                       // dcp_R对应的温度
+
+    void resize(size_t nSpecies);
+    void invalidate() { T = -1.0; Tderiv = -1.0; }
+};
+
+// 组分热力学数据库 - 初始化后只读, 可由多个相对象、多个线程通过 shared_ptr<const> 共享
+// 包含组分数据、元素表及分子量、NASA7/NASA9系数表; 所有求值函数都是const且只写调用者的workspace,
+// 不需要加锁, 系数数据也不随相对象复制
+class SpeciesThermo {
+public:
+    SpeciesThermo() = default;
+    explicit SpeciesThermo(std::vector<ChemistryVars::ThermoData> species);
+
+    size_t nSpecies() const { return m_species.size(); }
+    const std::vector<ChemistryVars::ThermoData>& species() const { return m_species; }
+    const ChemistryVars::ThermoData& species(size_t k) const { return m_species[k]; }
+
+    const ElementTable& elements() const { return m_elements; }
+    const std::vector<double>& molecularWeights() const { return m_molecularWeights; }
+    const Nasa7Table& nasa7() const { return m_nasa; }
+    const Nasa9Table& nasa9() const { return m_nasa9; }
+
+    // 系数分段温度 (NASA7的Tmid, NASA9各区间下限), 用于建立插值表
+    std::vector<double> breakpoints() const;
+
+    // 精确计算全部组分, 输出长度为nSpecies(); work只用作NASA9的临时空间
+    void evaluate(double T, double* h_RT, double* s_R, double* cp_R, ThermoWorkspace& work) const;
+    // 同时计算 d(cp/R)/dT, 与性质在同一次内核遍历中完成
+    void evaluate(double T, double* h_RT, double* s_R, double* cp_R, double* dcp_R, ThermoWorkspace& work) const;
+
+    // 更新work中的参考态性质 (温度未变时直接返回); table覆盖T时用插值代替多项式
+    void update(double T, ThermoWorkspace& work, const ThermoTable* table = nullptr) const;
+
+    // 更新性质及 d(cp/R)/dT; 导数总是由多项式精确计算, 同一次遍历得到的性质也取精确值
+    void updateDerivatives(double T, ThermoWorkspace& work) const;
+
+private:
+    // 从first开始的组分设为默认值, 并计算全部组分的g/RT
+    void fillDefaults(size_t first, ThermoWorkspace& work) const;
+
+    std::vector<ChemistryVars::ThermoData> m_species;
+    ElementTable m_elements;
+    std::vector<double> m_molecularWeights;     // kg/kmol
+    Nasa7Table m_nasa;
+    Nasa9Table m_nasa9;
+};
@@ -0,0 +1,282 @@
+#include "ThermoBatch.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+
+// 每个线程的临时数组 (一次调用内复用, 不分配到对象上)
+struct ThermoBatch::Workspace {
+    ThermoWorkspace thermo;                     // h/RT, s/R, cp/R (没有热力学数据的组分为默认值)
+    std::vector<double> yw;                     // Y_k / W_k
+};
+
+ThermoBatch::ThermoBatch(const IdealGasPhase& phase)
+    : m_species(phase.speciesThermo()), m_table(phase.thermoTable()), m_p0(phase.refPressure()) {
+    const std::vector<double>& mw = phase.molecularWeights();
+    m_invMW.resize(mw.size());
+    for (size_t k = 0; k < mw.size(); ++k) {
+        m_invMW[k] = mw[k] > 0.0 ? 1.0 / mw[k] : 0.0;
+    }
+
+    // 温度反求用的焓多项式: H/R = a5 + T(a0 + T(a1/2 + ...)), 按Tmid分组后可以逐组合并
+    // (没有NASA7数据的组分系数为0, 焓为0, 与SpeciesThermo的默认值一致)
+    const Nasa7Table& nasa = m_species->nasa7();
+    const int rows[6] = { Nasa7Table::A5, Nasa7Table::A0, Nasa7Table::H1, Nasa7Table::H2, Nasa7Table::H3, Nasa7Table::H4 };
+    m_group.resize(nasa.nSpecies());
+    m_hCoeffs.resize(nasa.nSpecies() * 12);
+    for (size_t k = 0; k < nasa.nSpecies(); ++k) {
+        auto it = std::find(m_groupTmid.begin(), m_groupTmid.end(), nasa.Tmid(k));
+        m_group[k] = it - m_groupTmid.begin();
+        if (it == m_groupTmid.end()) m_groupTmid.push_back(nasa.Tmid(k));
+        for (int range = 0; range < 2; ++range) {
+            for (int j = 0; j < 6; ++j) {
+                m_hCoeffs[k * 12 + range * 6 + j] = nasa.coeff(k, range, rows[j]);
+            }
+        }
+    }
+}
+
+void ThermoBatch::evaluate(const States& states, const Properties& out, size_t nThreads) const {
+    if (states.n == 0) return;
+    if (!states.T || !states.Y) {
+        throw std::invalid_argument("ThermoBatch: temperature and mass fraction arrays are required");
+    }
+    if (states.n > 1 && states.stateStride == 0) {
+        throw std::invalid_argument("ThermoBatch: stateStride is required for more than one state");
+    }
+    if (!states.P && (out.entropy_mass || out.density)) {
+        throw std::invalid_argument("ThermoBatch: entropy and density require pressures");
+    }
+
+    if (nThreads == 0) nThreads = std::max(1u, std::thread::hardware_concurrency());
+    nThreads = std::max<size_t>(1, std::min(nThreads, states.n / MinStatesPerThread));
+
+    // 各线程处理一段连续的状态
+    size_t chunk = (states.n + nThreads - 1) / nThreads;
+    std::vector<std::thread> workers;
+    for (size_t t = 1; t < nThreads; ++t) {
+        size_t begin = std::min(states.n, t * chunk);
+        size_t end = std::min(states.n, begin + chunk);
+        workers.emplace_back([this, &states, &out, begin, end]() {
+            Workspace work;
+            evaluateRange(states, out, begin, end, work);
+        });
+    }
+    Workspace work;
+    evaluateRange(states, out, 0, std::min(states.n, chunk), work);
+    for (auto& worker : workers) worker.join();
+}
+
+void ThermoBatch::evaluateRange(const States& states, const Properties& out, size_t begin, size_t end,
+    Workspace& work) const {
+    size_t nsp = nSpecies();
+    work.thermo.resize(nsp);
+    work.yw.assign(nsp, 0.0);
+
+    const bool wantEntropy = out.entropy_mass != nullptr;
+    for (size_t i = begin; i < end; ++i) {
+        double T = states.T[i * states.strideT];
+        m_species->update(T, work.thermo, m_table.get());
+
+        // 一次遍历得到全部求和: Σ Y, Σ Y/W, Σ (Y/W) cp/R, Σ (Y/W) h/RT
+        const double* Y = states.Y + i * states.stateStride;
+        const double* h = work.thermo.h_RT.data();
+        const double* cp = work.thermo.cp_R.data();
+        double* yw = work.yw.data();
+        double sumY = 0.0, sumN = 0.0, sumCp = 0.0, sumH = 0.0;
+        for (size_t k = 0; k < nsp; ++k) {
+            double y = Y[k * states.speciesStride];
+            double n = y * m_invMW[k];
+            yw[k] = n;
+            sumY += y;
+            sumN += n;
+            sumCp += n * cp[k];
+            sumH += n * h[k];
+        }
+
+        double meanMW = sumY / sumN;
+        double cp_mass = GasConstant * sumCp / sumY;
+        double h_mass = GasConstant * T * sumH / sumY;
+        double R_mass = GasConstant / meanMW;
+        size_t o = i * out.stride;
+        if (out.meanMolecularWeight) out.meanMolecularWeight[o] = meanMW;
+        if (out.cp_mass) out.cp_mass[o] = cp_mass;
+        if (out.cv_mass) out.cv_mass[o] = cp_mass - R_mass;
+        if (out.enthalpy_mass) out.enthalpy_mass[o] = h_mass;
+        if (out.intEnergy_mass) out.intEnergy_mass[o] = h_mass - R_mass * T;
+
+        double P = states.P ? states.P[i * states.strideP] : 0.0;
+        if (out.density) out.density[o] = P * meanMW / (GasConstant * T);
+        if (wantEntropy) {
+            // s = R Σ x_k (s_k/R - ln x_k) - R ln(P/P0)
+            const double* s = work.thermo.s_R.data();
+            double invN = 1.0 / sumN;
+            double sum = 0.0;
+            for (size_t k = 0; k < nsp; ++k) {
+                double x = yw[k] * invN;
+                sum += x * s[k];
+                if (x > 1e-100) sum -= x * std::log(x);
+            }
+            out.entropy_mass[o] = GasConstant * (sum - std::log(P / m_p0)) / meanMW;
+        }
+    }
+}
+
+ThermoBatch::InversionStats ThermoBatch::invertEnthalpy(const States& states, const double* h, size_t strideH,
+    double* T, size_t strideOut, size_t nThreads) const {
+    if (!states.Y || !h || !T) {
+        throw std::invalid_argument("ThermoBatch: mass fractions, enthalpies and output temperatures are required");
+    }
+    if (states.n > 1 && states.stateStride == 0) {
+        throw std::invalid_argument("ThermoBatch: stateStride is required for more than one state");
+    }
+    if (nThreads == 0) nThreads = std::max(1u, std::thread::hardware_concurrency());
+    nThreads = std::max<size_t>(1, std::min(nThreads, states.n / MinStatesPerThread));
+
+    // 各线程处理一段连续的状态, 统计结果最后合并
+    std::vector<InversionStats> partial(nThreads);
+    size_t chunk = (states.n + nThreads - 1) / nThreads;
+    std::vector<std::thread> workers;
+    for (size_t t = 1; t < nThreads; ++t) {
+        size_t begin = std::min(states.n, t * chunk);
+        size_t end = std::min(states.n, begin + chunk);
+        workers.emplace_back([this, &states, h, strideH, T, strideOut, begin, end, &partial, t]() {
+            invertRange(states, h, strideH, T, strideOut, begin, end, partial[t]);
+        });
+    }
+    invertRange(states, h, strideH, T, strideOut, 0, std::min(states.n, chunk), partial[0]);
+    for (auto& worker : workers) worker.join();
+
+    InversionStats stats;
+    stats.histogram.assign(MaxInversionIterations + 1, 0);
+    for (const InversionStats& p : partial) {
+        stats.nStates += p.nStates;
+        stats.totalIterations += p.totalIterations;
+        stats.maxIterations = std::max(stats.maxIterations, p.maxIterations);
+        stats.nFailed += p.nFailed;
+        for (size_t i = 0; i < p.histogram.size(); ++i) stats.histogram[i] += p.histogram[i];
+    }
+    return stats;
+}
+
+void ThermoBatch::invertRange(const States& states, const double* h, size_t strideH, double* T, size_t strideOut,
+    size_t begin, size_t end, InversionStats& stats) const {
+    const size_t L = InversionBlock;
+    const size_t nsp = nSpecies();
+    const size_t nTable = m_species->nasa7().nSpecies();
+    const size_t nGroups = m_groupTmid.size();
+    const bool exact = m_species->nasa9().nSpecies() > 0;
+
+    stats.histogram.assign(MaxInversionIterations + 1, 0);
+    std::vector<double> coeffs(std::max<size_t>(nGroups, 1) * 12 * L), target(L), temperature(L), sumY(L), n(L);
+    std::vector<double> moles;
+    std::vector<int> iterations(L);
+    ThermoWorkspace work;
+    if (exact) {
+        work.resize(nsp);
+        moles.resize(nsp);
+    }
+
+    for (size_t b = begin; b < end; b += L) {
+        size_t m = std::min(L, end - b);
+        std::fill(sumY.begin(), sumY.end(), 0.0);
+        std::fill(coeffs.begin(), coeffs.end(), 0.0);
+
+        if (exact) {
+            // 含NASA9组分: 逐个状态用精确求值迭代
+            for (size_t l = 0; l < m; ++l) {
+                size_t i = b + l;
+                const double* Y = states.Y + i * states.stateStride;
+                for (size_t k = 0; k < nsp; ++k) {
+                    double y = Y[k * states.speciesStride];
+                    sumY[l] += y;
+                    moles[k] = y * m_invMW[k];
+                }
+                double guess = states.T ? states.T[i * states.strideT] : 1500.0;
+                temperature[l] = invertExact(moles.data(), h[i * strideH] * sumY[l] / GasConstant, guess, work,
+                    iterations[l]);
+            }
+        }
+        else {
+            // 各组分的焓多项式按Tmid分组累加成每个状态的混合物多项式 (按状态连续, 内层循环可以向量化)
+            for (size_t k = 0; k < nsp; ++k) {
+                for (size_t l = 0; l < m; ++l) {
+                    double y = states.Y[(b + l) * states.stateStride + k * states.speciesStride];
+                    sumY[l] += y;
+                    n[l] = y * m_invMW[k];
+                }
+                if (k >= nTable) continue;      // 没有热力学数据的组分焓为0
+                double* group = coeffs.data() + m_group[k] * 12 * L;
+                const double* a = m_hCoeffs.data() + k * 12;
+                for (size_t j = 0; j < 12; ++j) {
+                    double* dst = group + j * L;
+                    double c = a[j];
+                    for (size_t l = 0; l < m; ++l) dst[l] += n[l] * c;
+                }
+            }
+            for (size_t l = 0; l < L; ++l) {
+                size_t i = b + l;
+                target[l] = l < m ? h[i * strideH] * sumY[l] / GasConstant : 0.0;
+                temperature[l] = l < m && states.T ? states.T[i * states.strideT] : 1500.0;
+            }
+            ThermoKernels::invertEnthalpy(ThermoKernels::activeIsa(), coeffs.data(), L, m_groupTmid.data(), nGroups,
+                m, target.data(), temperature.data(), iterations.data(),
+                IdealGasPhase::InversionTmin, IdealGasPhase::InversionTmax, MaxInversionIterations);
+        }
+
+        for (size_t l = 0; l < m; ++l) {
+            T[(b + l) * strideOut] = temperature[l];
+            stats.nStates++;
+            if (iterations[l] > MaxInversionIterations) {
+                stats.nFailed++;
+                continue;
+            }
+            stats.totalIterations += iterations[l];
+            stats.maxIterations = std::max(stats.maxIterations, iterations[l]);
+            stats.histogram[iterations[l]]++;
+        }
+    }
+}
+
+double ThermoBatch::invertExact(const double* n, double target, double guess, ThermoWorkspace& work,
+    int& iterations) const {
+    const double stepTol = 1e-9;
+    const double widthTol = 1e-14;
+    const size_t nsp = nSpecies();
+    double lo = IdealGasPhase::InversionTmin, hi = IdealGasPhase::InversionTmax;
+    double T = std::min(std::max(guess, lo), hi);
+    for (iterations = 1; iterations <= MaxInversionIterations; ++iterations) {
+        m_species->updateDerivatives(T, work);
+        double H = 0.0, cp = 0.0, dcp = 0.0;
+        for (size_t k = 0; k < nsp; ++k) {
+            H += n[k] * work.h_RT[k];
+            cp += n[k] * work.cp_R[k];
+            dcp += n[k] * work.dcp_R[k];
+        }
+        double r = H * T - target;
+        if (r == 0.0) return T;
+        if (r < 0.0) lo = T;
+        else hi = T;
+
+        double Tn = T;
+        bool newton = cp > 0.0;
+        if (newton) {
+            double step = r / cp;
+            double correction = 1.0 - 0.5 * step * dcp / cp;
+            if (correction > 0.5) step /= correction;
+            Tn = T - step;
+            if (std::abs(step) <= stepTol * T) return Tn;
+            newton = Tn > lo && Tn < hi;
+        }
+        if (!newton) {
+            Tn = 0.5 * (lo + hi);
+            if (hi - lo <= widthTol * Tn) {
+                if (lo == IdealGasPhase::InversionTmin || hi == IdealGasPhase::InversionTmax) break;
+                return Tn;
+            }
+        }
+        T = Tn;
+    }
+    iterations = MaxInversionIterations + 1;
+    return T;
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include "IdealGasPhase.h"
+#include <memory>
+#include <vector>
+
+// 批量多状态性质计算 - CFD求解器每一步计算大量网格单元的混合物性质
+// 构造时取得相的只读组分数据库 (共享, 不复制系数) 和分子量; 计算时不读写任何相对象的缓存,
+// 每个线程使用自己的临时数组, 同一对象可以从多个线程同时调用
+// 每个状态的组分性质由SIMD内核一次计算, 混合物的各个求和在一次遍历中完成
+class ThermoBatch {
+public:
+    // 输入状态 (SoA, 带步长): 第i个状态的温度为 T[i*strideT], 压力为 P[i*strideP],
+    // 组分k的质量分数为 Y[i*stateStride + k*speciesStride] (按和归一化后使用)
+    // 按组分存放 Y[k][nStates]: stateStride = 1, speciesStride = nStates
+    // 按状态存放 Y[nStates][k]: stateStride = nSpecies, speciesStride = 1
+    // stateStride没有默认布局, 多于一个状态时必须指定 (为0时抛出 std::invalid_argument)
+    struct States {
+        size_t n = 0;
+        const double* T = nullptr;
+        size_t strideT = 1;
+        const double* P = nullptr;              // Pa, 为空时不能计算熵和密度
+        size_t strideP = 1;
+        const double* Y = nullptr;
+        size_t stateStride = 0;
+        size_t speciesStride = 1;
+    };
+
+    // 输出数组, 为空的不计算; 第i个状态写到 [i*stride]
+    struct Properties {
+        double* meanMolecularWeight = nullptr;  // kg/kmol
+        double* cp_mass = nullptr;              // J/(kg·K)
+        double* cv_mass = nullptr;              // J/(kg·K)
+        double* enthalpy_mass = nullptr;        // J/kg
+        double* intEnergy_mass = nullptr;       // J/kg
+        double* entropy_mass = nullptr;         // J/(kg·K), 需要压力
+        double* density = nullptr;              // kg/m³, 需要压力
+        size_t stride = 1;
+    };
+
+    // 温度反求的迭代次数统计
+    struct InversionStats {
+        size_t nStates = 0;
+        size_t totalIterations = 0;             // 多项式计算次数之和 (不含未收敛的状态)
+        int maxIterations = 0;
+        size_t nFailed = 0;                     // 未收敛的状态数 (结果为最后的估计值)
+        std::vector<size_t> histogram;          // histogram[i]: 用了i次迭代的状态数
+        double meanIterations() const {
+            size_t converged = nStates - nFailed;
+            return converged > 0 ? static_cast<double>(totalIterations) / converged : 0.0;
+        }
+    };
+
+    explicit ThermoBatch(const IdealGasPhase& phase);
+
+    size_t nSpecies() const { return m_invMW.size(); }
+
+    // nThreads = 0 时使用 hardware_concurrency; 每个线程至少分到MinStatesPerThread个状态
+    // 要求熵或密度但没有给出压力时抛出 std::invalid_argument
+    void evaluate(const States& states, const Properties& out, size_t nThreads = 0) const;
+
+    // 由质量比焓反求温度 (组成不变): h[i*strideH] 为目标焓 J/kg, states.T 为初值 (为空时从1500 K开始),
+    // 结果写到 T[i*strideOut] (可以就是states.T); 不需要压力
+    // 每个状态先把各组分的焓多项式按Tmid分组合并成混合物多项式, 然后SIMD各通道同步做Newton迭代
+    // (与IdealGasPhase::setState_HP相同的Halley修正和区间保护); 含NASA9组分时逐个状态精确迭代
+    InversionStats invertEnthalpy(const States& states, const double* h, size_t strideH,
+        double* T, size_t strideOut, size_t nThreads = 0) const;
+
+    static const size_t MinStatesPerThread = 256;
+    static const size_t InversionBlock = 64;    // 一次合并系数并同步迭代的状态数
+    static const int MaxInversionIterations = 100;
+
+private:
+    struct Workspace;
+    void evaluateRange(const States& states, const Properties& out, size_t begin, size_t end, Workspace& work) const;
+    void invertRange(const States& states, const double* h, size_t strideH, double* T, size_t strideOut,
+        size_t begin, size_t end, InversionStats& stats) const;
+    // 单个状态的精确迭代 (含NASA9组分时使用); n为 Y_k/W_k, target为 h/R 乘 ΣY
+    double invertExact(const double* n, double target, double guess, ThermoWorkspace& work, int& iterations) const;
+
+    std::shared_ptr<const SpeciesThermo> m_species;
+    std::shared_ptr<const ThermoTable> m_table;
+    std::vector<double> m_groupTmid;            // 温度反求: 各组分Tmid的不同取值
+    std::vector<size_t> m_group;                // 各组分所属的Tmid分组
+    std::vector<double> m_hCoeffs;              // 各组分焓多项式 H/R: [k][range][6] = a5, a0, a1/2 .. a4/5
+    std::vector<double> m_invMW;                // 分子量的倒数 kmol/kg
+    double m_p0 = OneAtm;
+};
@@ -0,0 +1,579 @@
+#include "ThermoCodegen.h"
+#include "IdealGasPhase.h"
+#include "SpeciesThermo.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+// 按位组合, 选择展开哪些性质
+const int EmitEnthalpy = 1;
+const int EmitEntropy = 2;
+const int EmitCp = 4;
+
+enum class Form { TwoRange, OneRange, Nasa9, NoData };
+
+// 能精确还原为同一个双精度数的最短字面常数
+std::string literal(double value) {
+    char buffer[32];
+    for (int digits = 15; digits <= 17; ++digits) {
+        std::snprintf(buffer, sizeof(buffer), "%.*g", digits, value);
+        if (std::strtod(buffer, nullptr) == value) break;
+    }
+    std::string s(buffer);
+    if (s.find_first_of(".eE") == std::string::npos) s += ".0";
+    return s;
+}
+
+// 表达式末尾的加减项: " + v * factor" 或 " - |v| * factor"
+std::string term(double value, const std::string& factor = "") {
+    std::string s = value < 0.0 ? " - " + literal(-value) : " + " + literal(value);
+    return factor.empty() ? s : s + " * " + factor;
+}
+
+std::string quoted(const std::string& text) {
+    std::string s = "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\') s += '\\';
+        s += c;
+    }
+    return s + "\"";
+}
+
+void replaceAll(std::string& text, const std::string& from, const std::string& to) {
+    for (size_t pos = text.find(from); pos != std::string::npos; pos = text.find(from, pos + to.size())) {
+        text.replace(pos, from.size(), to);
+    }
+}
+
+// 与 Nasa7Table / Nasa9Table 相同的分类: 有效的NASA9优先, 否则至少7个低温系数才是NASA7
+Form formOf(const ChemistryVars::ThermoData& thermo) {
+    if (Nasa9Table::hasNasa9(thermo)) return Form::Nasa9;
+    if (thermo.coefficients.low.size() < 7) return Form::NoData;
+    if (thermo.coefficients.high.size() >= 7 && thermo.temperatureRanges.size() >= 3) return Form::TwoRange;
+    return Form::OneRange;
+}
+
+// NASA7: 与运行时内核相同的Horner形式和预除系数
+void emitNasa7(std::ostream& os, const std::string& indent, size_t k, const std::vector<double>& a, int mask) {
+    if (mask & EmitCp) {
+        os << indent << "cp_R[" << k << "] = " << literal(a[0]) << " + T * (" << literal(a[1]) << " + T * ("
+            << literal(a[2]) << " + T * (" << literal(a[3]) << " + T * " << literal(a[4]) << ")));\n";
+    }
+    if (mask & EmitEnthalpy) {
+        os << indent << "h_RT[" << k << "] = " << literal(a[0]) << " + T * (" << literal(a[1] / 2.0) << " + T * ("
+            << literal(a[2] / 3.0) << " + T * (" << literal(a[3] / 4.0) << " + T * " << literal(a[4] / 5.0) << ")))"
+            << term(a[5], "invT") << ";\n";
+    }
+    if (mask & EmitEntropy) {
+        os << indent << "s_R[" << k << "] = " << literal(a[0]) << " * logT + T * (" << literal(a[1]) << " + T * ("
+            << literal(a[2] / 2.0) << " + T * (" << literal(a[3] / 3.0) << " + T * " << literal(a[4] / 4.0) << ")))"
+            << term(a[6]) << ";\n";
+    }
+}
+
+void emitNasa9(std::ostream& os, const std::string& indent, size_t k, const std::vector<double>& a, int mask) {
+    if (mask & EmitCp) {
+        os << indent << "cp_R[" << k << "] = " << literal(a[0]) << " * invT2" << term(a[1], "invT") << term(a[2])
+            << " + T * (" << literal(a[3]) << " + T * (" << literal(a[4]) << " + T * (" << literal(a[5])
+            << " + T * " << literal(a[6]) << ")));\n";
+    }
+    if (mask & EmitEnthalpy) {
+        os << indent << "h_RT[" << k << "] = " << literal(-a[0]) << " * invT2 + (" << literal(a[1]) << " * logT"
+            << term(a[7]) << ") * invT" << term(a[2]) << " + T * (" << literal(a[3] * 0.5) << " + T * ("
+            << literal(a[4] * (1.0 / 3.0)) << " + T * (" << literal(a[5] * 0.25) << " + T * "
+            << literal(a[6] * 0.2) << ")));\n";
+    }
+    if (mask & EmitEntropy) {
+        os << indent << "s_R[" << k << "] = " << literal(-0.5 * a[0]) << " * invT2" << term(-a[1], "invT")
+            << term(a[2], "logT") << term(a[8]) << " + T * (" << literal(a[3]) << " + T * (" << literal(a[4] * 0.5)
+            << " + T * (" << literal(a[5] * (1.0 / 3.0)) << " + T * " << literal(a[6] * 0.25) << ")));\n";
+    }
+}
+
+// 一个求值函数: 先按Tmid分组展开两区间的NASA7组分, 再是单区间、NASA9和没有数据的组分
+void emitEvaluate(std::ostream& os, const std::vector<ChemistryVars::ThermoData>& species,
+    const std::string& signature, int mask) {
+    std::map<double, std::vector<size_t>> groups;
+    std::vector<size_t> oneRange, nasa9, noData;
+    for (size_t k = 0; k < species.size(); ++k) {
+        switch (formOf(species[k])) {
+        case Form::TwoRange: groups[species[k].temperatureRanges[1]].push_back(k); break;
+        case Form::OneRange: oneRange.push_back(k); break;
+        case Form::Nasa9: nasa9.push_back(k); break;
+        case Form::NoData: noData.push_back(k); break;
+        }
+    }
+
+    // 只声明用到的中间量
+    bool invT = (!groups.empty() || !oneRange.empty()) && (mask & EmitEnthalpy);
+    bool logT = (!groups.empty() || !oneRange.empty()) && (mask & EmitEntropy);
+    bool invT2 = !nasa9.empty();
+    invT = invT || invT2;
+    logT = logT || (!nasa9.empty() && (mask & (EmitEnthalpy | EmitEntropy)));
+
+    os << "inline void " << signature << " {\n";
+    if (invT) os << "    const double invT = 1.0 / T;\n";
+    if (invT2) os << "    const double invT2 = invT * invT;\n";
+    if (logT) os << "    const double logT = std::log(T);\n";
+
+    for (const auto& group : groups) {
+        os << "\n    // Tmid = " << literal(group.first) << " K, " << group.second.size() << " species\n";
+        for (int range = 1; range >= 0; --range) {
+            os << (range == 1 ? "    if (T > " + literal(group.first) + ") {\n" : "    else {\n");
+            for (size_t k : group.second) {
+                const ChemistryVars::ThermoData& thermo = species[k];
+                os << "        // " << thermo.name << "\n";
+                emitNasa7(os, "        ", k, range == 1 ? thermo.coefficients.high : thermo.coefficients.low, mask);
+            }
+            os << "    }\n";
+        }
+    }
+    if (!oneRange.empty()) {
+        os << "\n    // 单区间组分\n";
+        for (size_t k : oneRange) {
+            os << "    // " << species[k].name << "\n";
+            emitNasa7(os, "    ", k, species[k].coefficients.low, mask);
+        }
+    }
+    for (size_t k : nasa9) {
+        std::vector<ChemistryVars::ThermoData::NASA9Range> ranges = species[k].nasa9Coeffs;
+        std::sort(ranges.begin(), ranges.end(), [](const ChemistryVars::ThermoData::NASA9Range& a,
+            const ChemistryVars::ThermoData::NASA9Range& b) { return a.temperatureRange[0] < b.temperatureRange[0]; });
+        os << "\n    // " << species[k].name << " (NASA9, " << ranges.size() << " ranges)\n";
+        for (size_t r = ranges.size(); r-- > 0;) {
+            if (r == 0) os << (ranges.size() > 1 ? "    else {\n" : "    {\n");
+            else os << (r + 1 == ranges.size() ? "    if" : "    else if") << " (T > "
+                << literal(ranges[r].temperatureRange[0]) << ") {\n";
+            emitNasa9(os, "        ", k, ranges[r].coefficients, mask);
+            os << "    }\n";
+        }
+    }
+    if (!noData.empty()) {
+        os << "\n    // 没有热力学数据的组分: h/RT = s/R = 0, cp/R = 3.5\n";
+        for (size_t k : noData) {
+            if (mask & EmitCp) os << "    cp_R[" << k << "] = 3.5;\n";
+            if (mask & EmitEnthalpy) os << "    h_RT[" << k << "] = 0.0;\n";
+            if (mask & EmitEntropy) os << "    s_R[" << k << "] = 0.0;\n";
+        }
+    }
+    os << "}\n";
+}
+
+// 与组分无关的部分: 相对象
+const char* const PhaseClass = R"CODE(
+// 与运行时 IdealGasPhase 相同的状态设置和性质函数 (单位: K, Pa, kg/kmol, J/kmol, J/kg)
+// 压力总是以Pa为单位 (运行时版本把小于1e4的值当作atm); 参考态性质按温度缓存, 温度不变时只重新做混合物求和
+class IdealGasPhase {
+public:
+    IdealGasPhase() {
+        double X[NSpecies] = {};
+        X[0] = 1.0;
+        setMoleFractions(X);
+    }
+
+    std::size_t nSpecies() const { return NSpecies; }
+    const char* speciesName(std::size_t k) const { return SpeciesNames[k]; }
+    std::size_t speciesIndex(const char* name) const {
+        for (std::size_t k = 0; k < NSpecies; ++k) {
+            if (std::strcmp(SpeciesNames[k], name) == 0) return k;
+        }
+        return static_cast<std::size_t>(-1);
+    }
+    const double* molecularWeights() const { return MolecularWeights; }
+
+    // 状态设置函数
+    void setState_TPX(double T, double P, const double* X) {
+        setTemperature(T);
+        setPressure(P);
+        setMoleFractions(X);
+    }
+    void setState_TPY(double T, double P, const double* Y) {
+        setTemperature(T);
+        setPressure(P);
+        setMassFractions(Y);
+    }
+    void setState_TP(double T, double P) {
+        setTemperature(T);
+        setPressure(P);
+    }
+    void setTemperature(double T) { m_T = T; }
+    void setPressure(double P) { m_P = P; }
+
+    // 组成 (归一化后保存, 同时更新另一种分数和平均分子量)
+    void setMoleFractions(const double* X) {
+        double sum = 0.0;
+        for (std::size_t k = 0; k < NSpecies; ++k) sum += X[k];
+        for (std::size_t k = 0; k < NSpecies; ++k) m_X[k] = sum > 1e-100 ? X[k] / sum : X[k];
+        m_meanMW = 0.0;
+        for (std::size_t k = 0; k < NSpecies; ++k) m_meanMW += m_X[k] * MolecularWeights[k];
+        for (std::size_t k = 0; k < NSpecies; ++k) {
+            m_Y[k] = m_meanMW > 1e-100 ? m_X[k] * MolecularWeights[k] / m_meanMW : m_X[k];
+        }
+    }
+    void setMassFractions(const double* Y) {
+        double sum = 0.0;
+        for (std::size_t k = 0; k < NSpecies; ++k) sum += Y[k];
+        for (std::size_t k = 0; k < NSpecies; ++k) m_Y[k] = sum > 1e-100 ? Y[k] / sum : Y[k];
+        double moles = 0.0;
+        for (std::size_t k = 0; k < NSpecies; ++k) moles += m_Y[k] / MolecularWeights[k];
+        for (std::size_t k = 0; k < NSpecies; ++k) {
+            m_X[k] = moles > 1e-100 ? m_Y[k] / MolecularWeights[k] / moles : 0.0;
+        }
+        m_meanMW = 0.0;
+        for (std::size_t k = 0; k < NSpecies; ++k) m_meanMW += m_X[k] * MolecularWeights[k];
+    }
+    void getMoleFractions(double* X) const { std::memcpy(X, m_X, sizeof(m_X)); }
+    void getMassFractions(double* Y) const { std::memcpy(Y, m_Y, sizeof(m_Y)); }
+    double moleFraction(std::size_t k) const { return m_X[k]; }
+    double massFraction(std::size_t k) const { return m_Y[k]; }
+
+    double temperature() const { return m_T; }
+    double pressure() const { return m_P; }
+    double refPressure() const { return OneAtm; }
+    double meanMolecularWeight() const { return m_meanMW; }
+    double density() const { return m_P * m_meanMW / (GasConstant * m_T); }
+    double molarDensity() const { return density() / m_meanMW; }
+    double RT() const { return GasConstant * m_T; }
+
+    // 基本热力学性质
+    double enthalpy_mole() const {
+        updateThermo();
+        return mean_X(m_h) * RT();
+    }
+    double entropy_mole() const {
+        updateThermo();
+        double s_mix = -sum_xlogx() * GasConstant;
+        double s_ref = mean_X(m_s) * GasConstant;
+        double s_pressure = -GasConstant * std::log(m_P / OneAtm);
+        return s_ref + s_mix + s_pressure;
+    }
+    double gibbs_mole() const { return enthalpy_mole() - m_T * entropy_mole(); }
+    double cp_mole() const {
+        updateThermo();
+        return mean_X(m_cp) * GasConstant;
+    }
+    double cv_mole() const { return cp_mole() - GasConstant; }
+    double intEnergy_mole() const { return enthalpy_mole() - RT(); }
+
+    // 比热力学性质
+    double enthalpy_mass() const { return enthalpy_mole() / m_meanMW; }
+    double entropy_mass() const { return entropy_mole() / m_meanMW; }
+    double gibbs_mass() const { return gibbs_mole() / m_meanMW; }
+    double cp_mass() const { return cp_mole() / m_meanMW; }
+    double cv_mass() const { return cv_mole() / m_meanMW; }
+    double intEnergy_mass() const { return intEnergy_mole() / m_meanMW; }
+
+    // 各组分参考态性质 (当前温度), 数组长度NSpecies
+    void getEnthalpy_RT_ref(double* hrt) const {
+        updateThermo();
+        std::memcpy(hrt, m_h, sizeof(m_h));
+    }
+    void getEntropy_R_ref(double* sr) const {
+        updateThermo();
+        std::memcpy(sr, m_s, sizeof(m_s));
+    }
+    void getCp_R_ref(double* cpr) const {
+        updateThermo();
+        std::memcpy(cpr, m_cp, sizeof(m_cp));
+    }
+
+private:
+    void updateThermo() const {
+        if (m_T == m_Tthermo) return;
+        evaluate(m_T, m_h, m_s, m_cp);
+        m_Tthermo = m_T;
+    }
+    double mean_X(const double* values) const {
+        double sum = 0.0;
+        for (std::size_t k = 0; k < NSpecies; ++k) sum += m_X[k] * values[k];
+        return sum;
+    }
+    double sum_xlogx() const {
+        double sum = 0.0;
+        for (std::size_t k = 0; k < NSpecies; ++k) {
+            if (m_X[k] > 1e-100) sum += m_X[k] * std::log(m_X[k]);
+        }
+        return sum;
+    }
+
+    double m_T = 298.15;                        // K
+    double m_P = OneAtm;                        // Pa
+    double m_X[NSpecies];                       // 摩尔分数
+    double m_Y[NSpecies];                       // 质量分数
+    double m_meanMW = 0.0;                      // kg/kmol
+    mutable double m_h[NSpecies];               // h/RT
+    mutable double m_s[NSpecies];               // s/R
+    mutable double m_cp[NSpecies];              // cp/R
+    mutable double m_Tthermo = -1.0;            // 上述数组对应的温度
+};
+)CODE";
+
+// 验证程序, @NS@ @HEADER@ @SOURCE@ @TOLERANCE@ 在生成时替换
+const char* const TestProgram = R"CODE(// @NS@ 验证程序 - 由 yaml_convector codegen 生成, 不要手工修改
+// 在温度、压力和组成网格上比较 @HEADER@ 与运行时 IdealGasPhase, 全部相对误差在容差内时返回0
+#include @HEADER@
+#include "IdealGasPhase.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace {
+
+// 最大相对误差 |value - exact| / max(|exact|, scale), scale为该性质的量级 (避免在零点附近放大)
+struct Check {
+    double worst = 0.0;
+    std::string worstName;
+    double worstT = 0.0;
+    size_t count = 0;
+
+    void operator()(const std::string& name, double T, double value, double exact, double scale) {
+        double err = std::abs(value - exact) / std::max(std::abs(exact), scale);
+        if (std::isnan(err)) err = std::numeric_limits<double>::infinity();
+        ++count;
+        if (err > worst) {
+            worst = err;
+            worstName = name;
+            worstT = T;
+        }
+    }
+};
+
+template <typename Func>
+double timeNsPerSpecies(Func&& func) {
+    const int n = 20000;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; ++i) func(300.0 + (i % 2700));
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    return ns / n / @NS@::NSpecies;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::string yamlFile = argc > 1 ? argv[1] : @SOURCE@;
+    const double tolerance = @TOLERANCE@;
+    const size_t n = @NS@::NSpecies;
+
+    try {
+        ::IdealGasPhase runtime(yamlFile);
+        @NS@::IdealGasPhase generated;
+        if (runtime.nSpecies() != n) {
+            std::cerr << "Species count mismatch: " << n << " generated, " << runtime.nSpecies() << " in " << yamlFile << std::endl;
+            return 1;
+        }
+        Check check;
+        for (size_t k = 0; k < n; ++k) {
+            if (runtime.speciesName(k) != @NS@::SpeciesNames[k]) {
+                std::cerr << "Species " << k << " is " << @NS@::SpeciesNames[k] << ", runtime has " << runtime.speciesName(k) << std::endl;
+                return 1;
+            }
+            check(std::string("MW ") + @NS@::SpeciesNames[k], 0.0, @NS@::MolecularWeights[k], runtime.molecularWeights()[k], 1.0);
+        }
+
+        // 组分参考态性质: 温度网格加上全部分段温度 (正好在Tmid上时两边都取低温区间)
+        std::vector<double> temperatures;
+        for (double T = 200.0; T <= 4000.0; T += 7.0) temperatures.push_back(T);
+        for (size_t k = 0; k < n; ++k) {
+            if (@NS@::Tmid[k] > 0.0) temperatures.push_back(@NS@::Tmid[k]);
+        }
+        std::vector<double> h(n), s(n), cp(n), h0(n), s0(n), cp0(n);
+        ThermoWorkspace work;
+        work.resize(n);
+        for (double T : temperatures) {
+            runtime.speciesThermo()->evaluate(T, h0.data(), s0.data(), cp0.data(), work);
+            @NS@::evaluate(T, h.data(), s.data(), cp.data());
+            for (int pass = 0; pass < 2; ++pass) {
+                for (size_t k = 0; k < n; ++k) {
+                    std::string name = @NS@::SpeciesNames[k];
+                    check("h/RT " + name, T, h[k], h0[k], 1.0);
+                    check("s/R " + name, T, s[k], s0[k], 1.0);
+                    check("cp/R " + name, T, cp[k], cp0[k], 1.0);
+                }
+                // 单独的求值函数
+                @NS@::evaluateEnthalpy_RT(T, h.data());
+                @NS@::evaluateEntropy_R(T, s.data());
+                @NS@::evaluateCp_R(T, cp.data());
+            }
+        }
+
+        // 混合物性质: 三种组成 (第三种通过质量分数设定), 两个压力
+        std::vector<std::vector<double>> compositions(3, std::vector<double>(n));
+        for (size_t k = 0; k < n; ++k) {
+            compositions[0][k] = 1.0;
+            compositions[1][k] = 1.0 + k % 5;
+            compositions[2][k] = k == 0 ? 0.9 : 0.1 / n;
+        }
+        const double pressures[] = { OneAtm, 25.0 * OneAtm };
+        for (size_t c = 0; c < compositions.size(); ++c) {
+            for (double P : pressures) {
+                for (double T = 300.0; T <= 3000.0; T += 50.0) {
+                    if (c == 2) {
+                        runtime.setState_TPY(T, P, compositions[c].data());
+                        generated.setState_TPY(T, P, compositions[c].data());
+                    }
+                    else {
+                        runtime.setState_TPX(T, P, compositions[c].data());
+                        generated.setState_TPX(T, P, compositions[c].data());
+                    }
+                    double mw = runtime.meanMolecularWeight();
+                    double RT = GasConstant * T;
+                    for (size_t k = 0; k < n; ++k) {
+                        check("X", T, generated.moleFraction(k), runtime.moleFraction(k), 1.0);
+                        check("Y", T, generated.massFraction(k), runtime.massFraction(k), 1.0);
+                    }
+                    check("meanMolecularWeight", T, generated.meanMolecularWeight(), mw, 1.0);
+                    check("density", T, generated.density(), runtime.density(), 0.0);
+                    check("enthalpy_mole", T, generated.enthalpy_mole(), runtime.enthalpy_mole(), RT);
+                    check("intEnergy_mole", T, generated.intEnergy_mole(), runtime.intEnergy_mole(), RT);
+                    check("gibbs_mole", T, generated.gibbs_mole(), runtime.gibbs_mole(), RT);
+                    check("entropy_mole", T, generated.entropy_mole(), runtime.entropy_mole(), GasConstant);
+                    check("cp_mole", T, generated.cp_mole(), runtime.cp_mole(), GasConstant);
+                    check("cv_mole", T, generated.cv_mole(), runtime.cv_mole(), GasConstant);
+                    check("enthalpy_mass", T, generated.enthalpy_mass(), runtime.enthalpy_mass(), RT / mw);
+                    check("intEnergy_mass", T, generated.intEnergy_mass(), runtime.intEnergy_mass(), RT / mw);
+                    check("gibbs_mass", T, generated.gibbs_mass(), runtime.gibbs_mass(), RT / mw);
+                    check("entropy_mass", T, generated.entropy_mass(), runtime.entropy_mass(), GasConstant / mw);
+                    check("cp_mass", T, generated.cp_mass(), runtime.cp_mass(), GasConstant / mw);
+                    check("cv_mass", T, generated.cv_mass(), runtime.cv_mass(), GasConstant / mw);
+                }
+            }
+        }
+
+        volatile double sink = 0.0;
+        double tGenerated = timeNsPerSpecies([&](double T) {
+            @NS@::evaluate(T, h.data(), s.data(), cp.data());
+            sink = sink + cp[0];
+        });
+        double tRuntime = timeNsPerSpecies([&](double T) {
+            runtime.speciesThermo()->evaluate(T, h0.data(), s0.data(), cp0.data(), work);
+            sink = sink + cp0[0];
+        });
+
+        std::cout << "Generated thermo (" << n << " species) vs runtime IdealGasPhase (" << yamlFile << ")" << std::endl;
+        std::cout << "  " << check.count << " values, max relative difference " << check.worst << " ("
+            << check.worstName << " at T = " << check.worstT << " K)" << std::endl;
+        std::cout << "  evaluate: generated " << tGenerated << " ns/species, runtime kernel ("
+            << ThermoKernels::isaName(ThermoKernels::activeIsa()) << ") " << tRuntime << " ns/species" << std::endl;
+        if (!(check.worst <= tolerance)) {
+            std::cout << "FAILED: tolerance " << tolerance << std::endl;
+            return 1;
+        }
+        std::cout << "PASSED" << std::endl;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+)CODE";
+
+} // namespace
+
+std::string ThermoCodegen::identifierFromPath(const std::string& path) {
+    size_t begin = path.find_last_of("/\\");
+    begin = begin == std::string::npos ? 0 : begin + 1;
+    size_t end = path.find_last_of('.');
+    if (end == std::string::npos || end < begin) end = path.size();
+
+    std::string id;
+    for (size_t i = begin; i < end; ++i) {
+        unsigned char c = static_cast<unsigned char>(path[i]);
+        id += std::isalnum(c) ? static_cast<char>(c) : '_';
+    }
+    if (id.empty() || std::isdigit(static_cast<unsigned char>(id[0]))) id = "m_" + id;
+    return id;
+}
+
+std::string ThermoCodegen::generateHeader(const std::vector<ChemistryVars::ThermoData>& species, const Options& options) {
+    if (species.empty()) {
+        throw std::invalid_argument("ThermoCodegen: no species");
+    }
+    // 分子量与运行时相同 (由元素表计算)
+    SpeciesThermo thermo(species);
+    const size_t n = species.size();
+    size_t n7 = 0, n9 = 0;
+    for (const auto& sp : species) {
+        Form form = formOf(sp);
+        if (form == Form::TwoRange || form == Form::OneRange) ++n7;
+        if (form == Form::Nasa9) ++n9;
+    }
+
+    std::ostringstream os;
+    os << "// " << options.namespaceName << " 热力学 - 由 yaml_convector codegen"
+        << (options.source.empty() ? "" : " 从 " + options.source) << " 生成, 不要手工修改\n";
+    os << "// " << n << " 个组分 (NASA7 " << n7 << ", NASA9 " << n9 << "); 单位: K, Pa, kg/kmol, J/kmol, J/kg\n";
+    os << "#pragma once\n#include <cmath>\n#include <cstddef>\n#include <cstring>\n\n";
+    os << "namespace " << options.namespaceName << " {\n\n";
+    os << "constexpr std::size_t NSpecies = " << n << ";\n";
+    os << "constexpr double GasConstant = " << literal(GasConstant) << ";  // J/(kmol·K)\n";
+    os << "constexpr double OneAtm = " << literal(OneAtm) << ";  // Pa, 参考压力\n\n";
+
+    os << "constexpr const char* SpeciesNames[NSpecies] = {";
+    for (size_t k = 0; k < n; ++k) os << (k % 8 == 0 ? "\n    " : " ") << quoted(species[k].name) << ",";
+    os << "\n};\n\n";
+
+    os << "// kg/kmol\nconstexpr double MolecularWeights[NSpecies] = {";
+    for (size_t k = 0; k < n; ++k) os << (k % 4 == 0 ? "\n    " : " ") << literal(thermo.molecularWeights()[k]) << ",";
+    os << "\n};\n\n";
+
+    os << "// NASA7分段温度 K (单区间和非NASA7组分为0)\nconstexpr double Tmid[NSpecies] = {";
+    for (size_t k = 0; k < n; ++k) {
+        double Tmid = formOf(species[k]) == Form::TwoRange ? species[k].temperatureRanges[1] : 0.0;
+        os << (k % 8 == 0 ? "\n    " : " ") << literal(Tmid) << ",";
+    }
+    os << "\n};\n\n";
+
+    os << "// NASA7系数 a0..a6 [组分][低温区间, 高温区间] (单区间组分两组相同, 非NASA7组分为0)\n";
+    os << "constexpr double Nasa7Coeffs[NSpecies][2][7] = {\n";
+    for (size_t k = 0; k < n; ++k) {
+        Form form = formOf(species[k]);
+        bool nasa7 = form == Form::TwoRange || form == Form::OneRange;
+        os << "    {";
+        for (int range = 0; range < 2; ++range) {
+            const std::vector<double>& a = range == 1 && form == Form::TwoRange ?
+                species[k].coefficients.high : species[k].coefficients.low;
+            os << (range == 0 ? " {" : ", {");
+            for (int c = 0; c < 7; ++c) os << (c == 0 ? " " : ", ") << literal(nasa7 ? a[c] : 0.0);
+            os << " }";
+        }
+        os << " },  // " << species[k].name << "\n";
+    }
+    os << "};\n\n";
+
+    os << "// 参考态 h/RT, s/R, cp/R, 数组长度NSpecies\n";
+    emitEvaluate(os, species, "evaluate(double T, double* h_RT, double* s_R, double* cp_R)",
+        EmitEnthalpy | EmitEntropy | EmitCp);
+    os << "\n";
+    emitEvaluate(os, species, "evaluateEnthalpy_RT(double T, double* h_RT)", EmitEnthalpy);
+    os << "\n";
+    emitEvaluate(os, species, "evaluateEntropy_R(double T, double* s_R)", EmitEntropy);
+    os << "\n";
+    emitEvaluate(os, species, "evaluateCp_R(double T, double* cp_R)", EmitCp);
+    os << PhaseClass;
+    os << "\n} // namespace " << options.namespaceName << "\n";
+    return os.str();
+}
+
+std::string ThermoCodegen::generateTest(const std::vector<ChemistryVars::ThermoData>& species,
+    const std::string& headerName, const Options& options) {
+    if (species.empty()) {
+        throw std::invalid_argument("ThermoCodegen: no species");
+    }
+    std::string text = TestProgram;
+    replaceAll(text, "@NS@", options.namespaceName);
+    replaceAll(text, "@HEADER@", quoted(headerName));
+    replaceAll(text, "@SOURCE@", quoted(options.source));
+    replaceAll(text, "@TOLERANCE@", literal(options.tolerance));
+    return text;
+}
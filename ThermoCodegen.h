@@ -0,0 +1,32 @@
+#pragma once
+#include "ChemistryVars.h"
+#include <string>
+#include <vector>
+
+// 机理专用的热力学代码生成 - 由组分数据生成独立的C++头文件 (只依赖标准库), 编译进求解器使用
+// 生成的头文件包含:
+//   constexpr 数组: 组分名、分子量、NASA7的Tmid和系数 (供查询, 求值不经过数组)
+//   evaluate(T, h_RT, s_R, cp_R) 等: 逐组分展开的多项式, 系数和Tmid都是字面常数,
+//     Tmid相同的组分共用一个分支; NASA9组分按各自的区间展开; 与运行时内核使用相同的多项式形式和预除系数
+//   class IdealGasPhase: 与运行时 IdealGasPhase 相同的状态设置和性质函数 (固定长度数组, 不分配内存)
+// 生成的验证程序用同一个YAML文件建立运行时 IdealGasPhase, 在温度、压力和组成网格上逐个比较性质
+namespace ThermoCodegen {
+
+struct Options {
+    std::string namespaceName = "mechanism";    // 生成代码的命名空间
+    std::string source;                         // 写入注释的来源 (YAML文件名); 验证程序的默认YAML路径
+    double tolerance = 1e-10;                   // 验证程序的相对误差上限
+};
+
+// 由文件名得到合法的C++标识符 (去掉目录和扩展名, 非法字符替换为'_')
+std::string identifierFromPath(const std::string& path);
+
+// 生成头文件的内容; 组分为空时抛出 std::invalid_argument
+std::string generateHeader(const std::vector<ChemistryVars::ThermoData>& species, const Options& options = Options());
+
+// 生成验证程序 (含main): headerName为生成的头文件在#include中的名字
+// 运行: <程序> [YAML文件], 全部性质在容差内时返回0
+std::string generateTest(const std::vector<ChemistryVars::ThermoData>& species, const std::string& headerName,
+    const Options& options = Options());
+
+} // namespace ThermoCodegen
@@ -0,0 +1,452 @@
+#include "ThermoKernels.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+
+#if defined(IDEALGAS_X86_SIMD) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// 各指令集的内核在单独的编译单元中实现 (ThermoKernels_avx2.cpp / ThermoKernels_avx512.cpp),
+// 只通过原始指针传递数据, 避免不同编译选项下的内联函数相互替换
+#ifdef IDEALGAS_X86_SIMD
+void nasa7KernelAvx2(const double* coeffs, const double* Tmid, size_t n, size_t stride,
+    double T, double logT, double* h_RT, double* s_R, double* cp_R, double* dcp_R);
+void nasa7KernelAvx512(const double* coeffs, const double* Tmid, size_t n, size_t stride,
+    double T, double logT, double* h_RT, double* s_R, double* cp_R, double* dcp_R);
+void nasa7KernelAvx2(const float* coeffs, const float* Tmid, size_t n, size_t stride,
+    float T, float invT, float logT, float* h_RT, float* s_R, float* cp_R);
+void nasa7KernelAvx512(const float* coeffs, const float* Tmid, size_t n, size_t stride,
+    float T, float invT, float logT, float* h_RT, float* s_R, float* cp_R);
+void nasa9KernelAvx2(const double* coeffs, const double* Tmin, size_t nRanges, size_t n, size_t stride,
+    double T, double logT, double* h_RT, double* s_R, double* cp_R, double* dcp_R);
+void nasa9KernelAvx512(const double* coeffs, const double* Tmin, size_t nRanges, size_t n, size_t stride,
+    double T, double logT, double* h_RT, double* s_R, double* cp_R, double* dcp_R);
+void invertEnthalpyAvx2(const double* coeffs, size_t stride, const double* groupTmid, size_t nGroups, size_t n,
+    const double* target, double* T, int* iterations, double Tmin, double Tmax, int maxIterations);
+void invertEnthalpyAvx512(const double* coeffs, size_t stride, const double* groupTmid, size_t nGroups, size_t n,
+    const double* target, double* T, int* iterations, double Tmin, double Tmax, int maxIterations);
+#endif
+
+static_assert(Nasa7Table::RowsPerRange == 14, "SIMD kernels hard-code the Nasa7Table row layout");
+
+namespace {
+
+// dcp_R 不为空时同时计算 d(cp/R)/dT; Real为系数和结果的类型, invT与logT由调用者在双精度下计算
+template <typename Real>
+void nasa7KernelScalar(const Real* coeffs, const Real* Tmid, size_t n, size_t stride,
+    Real T, Real invT, Real logT, Real* h_RT, Real* s_R, Real* cp_R, Real* dcp_R) {
+    typedef BasicNasa7Table<Real> Table;
+    const Real* lo = coeffs;
+    const Real* hi = coeffs + Table::RowsPerRange * stride;
+    for (size_t k = 0; k < n; ++k) {
+        const Real* a = (T > Tmid[k] ? hi : lo) + k;
+        Real a0 = a[0], a1 = a[stride], a2 = a[2 * stride], a3 = a[3 * stride];
+        Real a4 = a[4 * stride], a5 = a[5 * stride], a6 = a[6 * stride];
+        Real h1 = a[Table::H1 * stride], h2 = a[Table::H2 * stride];
+        Real h3 = a[Table::H3 * stride], h4 = a[Table::H4 * stride];
+        Real s2 = a[Table::S2 * stride], s3 = a[Table::S3 * stride], s4 = a[Table::S4 * stride];
+
+        cp_R[k] = a0 + T * (a1 + T * (a2 + T * (a3 + T * a4)));
+        h_RT[k] = a0 + T * (h1 + T * (h2 + T * (h3 + T * h4))) + a5 * invT;
+        s_R[k] = a0 * logT + T * (a1 + T * (s2 + T * (s3 + T * s4))) + a6;
+        if (dcp_R) dcp_R[k] = a1 + T * (Real(2) * a2 + T * (Real(3) * a3 + T * Real(4) * a4));
+    }
+}
+
+// NASA9: cp/R = a0/T^2 + a1/T + a2 + a3 T + a4 T^2 + a5 T^3 + a6 T^4
+//        h/RT = -a0/T^2 + a1 lnT/T + a2 + a3 T/2 + a4 T^2/3 + a5 T^3/4 + a6 T^4/5 + a7/T
+//        s/R = -a0/(2T^2) - a1/T + a2 lnT + a3 T + a4 T^2/2 + a5 T^3/3 + a6 T^4/4 + a8
+//        d(cp/R)/dT = -2a0/T^3 - a1/T^2 + a3 + 2a4 T + 3a5 T^2 + 4a6 T^3
+void nasa9KernelScalar(const double* coeffs, const double* Tmin, size_t nRanges, size_t n, size_t stride,
+    double T, double logT, double* h_RT, double* s_R, double* cp_R, double* dcp_R) {
+    const double invT = 1.0 / T;
+    const double invT2 = invT * invT;
+    for (size_t k = 0; k < n; ++k) {
+        // 区间序号 = 下限低于T的区间数 (第一个区间的下限不参与比较)
+        size_t range = 0;
+        for (size_t r = 1; r < nRanges; ++r) {
+            range += T > Tmin[r * stride + k] ? 1 : 0;
+        }
+        const double* a = coeffs + range * Nasa9Table::NCoeffs * stride + k;
+        double a0 = a[0], a1 = a[stride], a2 = a[2 * stride], a3 = a[3 * stride], a4 = a[4 * stride];
+        double a5 = a[5 * stride], a6 = a[6 * stride], a7 = a[7 * stride], a8 = a[8 * stride];
+
+        cp_R[k] = a0 * invT2 + a1 * invT + a2 + T * (a3 + T * (a4 + T * (a5 + T * a6)));
+        h_RT[k] = -a0 * invT2 + (a1 * logT + a7) * invT + a2 +
+            T * (a3 * 0.5 + T * (a4 * (1.0 / 3.0) + T * (a5 * 0.25 + T * a6 * 0.2)));
+        s_R[k] = -0.5 * a0 * invT2 - a1 * invT + a2 * logT + a8 +
+            T * (a3 + T * (a4 * 0.5 + T * (a5 * (1.0 / 3.0) + T * a6 * 0.25)));
+        if (dcp_R) {
+            dcp_R[k] = -(2.0 * a0 * invT + a1) * invT2 + a3 + T * (2.0 * a4 + T * (3.0 * a5 + T * 4.0 * a6));
+        }
+    }
+}
+
+// 每个通道独立做带区间保护的Newton迭代 (Halley修正), 收敛判据与SIMD内核相同
+void invertEnthalpyScalar(const double* coeffs, size_t stride, const double* groupTmid, size_t nGroups, size_t n,
+    const double* target, double* T, int* iterations, double Tmin, double Tmax, int maxIterations) {
+    const double stepTol = 1e-9;
+    const double widthTol = 1e-14;
+    for (size_t l = 0; l < n; ++l) {
+        double lo = Tmin, hi = Tmax;
+        double t = std::min(std::max(T[l], lo), hi);
+        int it = 0;
+        bool done = false, failed = false;
+        while (!done && it < maxIterations) {
+            ++it;
+            double H = 0.0, cp = 0.0, dcp = 0.0;
+            for (size_t g = 0; g < nGroups; ++g) {
+                const double* c = coeffs + (g * 2 + (t > groupTmid[g] ? 1 : 0)) * 6 * stride + l;
+                double c0 = c[0], c1 = c[stride], c2 = c[2 * stride];
+                double c3 = c[3 * stride], c4 = c[4 * stride], c5 = c[5 * stride];
+                H += c0 + t * (c1 + t * (c2 + t * (c3 + t * (c4 + t * c5))));
+                cp += c1 + t * (2.0 * c2 + t * (3.0 * c3 + t * (4.0 * c4 + t * 5.0 * c5)));
+                dcp += 2.0 * c2 + t * (6.0 * c3 + t * (12.0 * c4 + t * 20.0 * c5));
+            }
+            double r = H - target[l];
+            if (r == 0.0) {
+                done = true;
+                break;
+            }
+            if (r < 0.0) lo = t;
+            else hi = t;
+
+            // 步长小于容差时直接接受 (舍入后可能落在区间端点上)
+            double tn = t;
+            bool newton = cp > 0.0;
+            if (newton) {
+                double step = r / cp;
+                double correction = 1.0 - 0.5 * step * dcp / cp;
+                if (correction > 0.5) step /= correction;
+                tn = t - step;
+                done = std::abs(step) <= stepTol * t;
+                newton = done || (tn > lo && tn < hi);
+            }
+            if (!newton) {
+                tn = 0.5 * (lo + hi);
+                done = hi - lo <= widthTol * tn;
+                failed = done && (lo == Tmin || hi == Tmax);
+            }
+            t = tn;
+        }
+        T[l] = t;
+        iterations[l] = done && !failed ? it : maxIterations + 1;
+    }
+}
+
+bool validNasa9(const ChemistryVars::ThermoData& thermo) {
+    if (thermo.nasa9Coeffs.empty()) return false;
+    for (const auto& range : thermo.nasa9Coeffs) {
+        if (range.coefficients.size() != 9 || range.temperatureRange.size() != 2) return false;
+    }
+    return true;
+}
+
+bool cpuSupports(ThermoKernels::Isa isa) {
+    if (isa == ThermoKernels::Isa::Scalar) return true;
+#ifdef IDEALGAS_X86_SIMD
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) return false;
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool fma = (info[2] & (1 << 12)) != 0;
+    if (!osxsave) return false;
+    unsigned long long xcr0 = _xgetbv(0);
+    __cpuidex(info, 7, 0);
+    bool avx2 = fma && (info[1] & (1 << 5)) != 0 && (xcr0 & 0x6) == 0x6;
+    if (isa == ThermoKernels::Isa::AVX2) return avx2;
+    return avx2 && (info[1] & (1 << 16)) != 0 && (xcr0 & 0xE6) == 0xE6;
+#else
+    __builtin_cpu_init();
+    bool avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    if (isa == ThermoKernels::Isa::AVX2) return avx2;
+    return avx2 && __builtin_cpu_supports("avx512f");
+#endif
+#else
+    return false;
+#endif
+}
+
+std::atomic<int>& isaSetting() {
+    static std::atomic<int> isa(-1);
+    return isa;
+}
+
+} // namespace
+
+// Nasa7Table 实现
+
+template <typename Real>
+BasicNasa7Table<Real>::BasicNasa7Table(const std::vector<ChemistryVars::ThermoData>& species)
+    : m_nSpecies(species.size()) {
+    m_padded = (m_nSpecies + BlockSize - 1) / BlockSize * BlockSize;
+    if (m_padded == 0) m_padded = BlockSize;
+
+    // 没有NASA7数据的组分系数全为0 (h/RT = s/R = 0, cp/R由fillDefaults设为3.5);
+    // 补齐部分: cp/R=3.5, 使补齐的通道也得到有限值
+    m_coeffs.assign(2 * RowsPerRange * m_padded, 0.0);
+    m_Tmid.assign(m_padded, std::numeric_limits<Real>::max());
+    m_hasData.assign(m_nSpecies, 0);
+    for (int range = 0; range < 2; ++range) {
+        for (size_t k = m_nSpecies; k < m_padded; ++k) {
+            m_coeffs[(range * RowsPerRange + A0) * m_padded + k] = 3.5;
+        }
+    }
+
+    for (size_t k = 0; k < m_nSpecies; ++k) {
+        const auto& thermo = species[k];
+        const std::vector<double>& low = thermo.coefficients.low;
+        const std::vector<double>& high = thermo.coefficients.high;
+        if (low.size() < 7 || validNasa9(thermo)) {
+            m_noData.push_back(k);
+            continue;
+        }
+
+        // 只有一个区间时高温区间使用同一组系数
+        const std::vector<double>& upper = high.size() >= 7 ? high : low;
+        for (int range = 0; range < 2; ++range) {
+            const std::vector<double>& a = range == 0 ? low : upper;
+            Real* row = m_coeffs.data() + range * RowsPerRange * m_padded + k;
+            for (int c = 0; c < 7; ++c) {
+                row[c * m_padded] = static_cast<Real>(a[c]);
+            }
+            // 积分产生的分母在加载时一次除好 (双精度下相除后再舍入)
+            row[H1 * m_padded] = static_cast<Real>(a[1] / 2.0);
+            row[H2 * m_padded] = static_cast<Real>(a[2] / 3.0);
+            row[H3 * m_padded] = static_cast<Real>(a[3] / 4.0);
+            row[H4 * m_padded] = static_cast<Real>(a[4] / 5.0);
+            row[S2 * m_padded] = static_cast<Real>(a[2] / 2.0);
+            row[S3 * m_padded] = static_cast<Real>(a[3] / 3.0);
+            row[S4 * m_padded] = static_cast<Real>(a[4] / 4.0);
+        }
+        if (high.size() >= 7 && thermo.temperatureRanges.size() >= 3) {
+            m_Tmid[k] = static_cast<Real>(thermo.temperatureRanges[1]);
+        }
+        m_hasData[k] = 1;
+    }
+}
+
+template <typename Real>
+void BasicNasa7Table<Real>::evaluate(size_t k, Real T, Real& h_RT, Real& s_R, Real& cp_R) const {
+    nasa7KernelScalar(m_coeffs.data() + k, m_Tmid.data() + k, 1, m_padded, T,
+        static_cast<Real>(1.0 / static_cast<double>(T)), static_cast<Real>(std::log(static_cast<double>(T))),
+        &h_RT, &s_R, &cp_R, static_cast<Real*>(nullptr));
+    if (!m_hasData[k]) cp_R = static_cast<Real>(3.5);
+}
+
+template <typename Real>
+void BasicNasa7Table<Real>::fillDefaults(Real* cp_R) const {
+    for (size_t k : m_noData) cp_R[k] = static_cast<Real>(3.5);
+}
+
+template class BasicNasa7Table<double>;
+template class BasicNasa7Table<float>;
+
+// Nasa9Table 实现
+
+bool Nasa9Table::hasNasa9(const ChemistryVars::ThermoData& thermo) {
+    return validNasa9(thermo);
+}
+
+Nasa9Table::Nasa9Table(const std::vector<ChemistryVars::ThermoData>& species) {
+    for (size_t k = 0; k < species.size(); ++k) {
+        if (!validNasa9(species[k])) continue;
+        m_species.push_back(k);
+        m_nRanges = std::max(m_nRanges, species[k].nasa9Coeffs.size());
+    }
+    m_padded = (m_species.size() + BlockSize - 1) / BlockSize * BlockSize;
+    if (m_padded == 0) m_padded = BlockSize;
+    if (m_nRanges == 0) m_nRanges = 1;
+
+    // 补齐部分: cp/R=3.5
+    m_coeffs.assign(m_nRanges * NCoeffs * m_padded, 0.0);
+    m_Tmin.assign(m_nRanges * m_padded, std::numeric_limits<double>::max());
+    for (size_t j = 0; j < m_padded; ++j) {
+        m_coeffs[2 * m_padded + j] = 3.5;
+    }
+
+    for (size_t j = 0; j < m_species.size(); ++j) {
+        std::vector<ChemistryVars::ThermoData::NASA9Range> ranges = species[m_species[j]].nasa9Coeffs;
+        std::sort(ranges.begin(), ranges.end(), [](const ChemistryVars::ThermoData::NASA9Range& a,
+            const ChemistryVars::ThermoData::NASA9Range& b) { return a.temperatureRange[0] < b.temperatureRange[0]; });
+        for (size_t r = 0; r < ranges.size(); ++r) {
+            for (int c = 0; c < NCoeffs; ++c) {
+                m_coeffs[(r * NCoeffs + c) * m_padded + j] = ranges[r].coefficients[c];
+            }
+            m_Tmin[r * m_padded + j] = ranges[r].temperatureRange[0];
+        }
+    }
+}
+
+void Nasa9Table::evaluate(size_t j, double T, double& h_RT, double& s_R, double& cp_R) const {
+    nasa9KernelScalar(m_coeffs.data() + j, m_Tmin.data() + j, m_nRanges, 1, m_padded, T, std::log(T),
+        &h_RT, &s_R, &cp_R, nullptr);
+}
+
+// ThermoKernels 实现
+
+ThermoKernels::Isa ThermoKernels::detectIsa() {
+    // CPU特性只检测一次
+    static const Isa detected = cpuSupports(Isa::AVX512) ? Isa::AVX512 :
+        cpuSupports(Isa::AVX2) ? Isa::AVX2 : Isa::Scalar;
+    return detected;
+}
+
+bool ThermoKernels::isSupported(Isa isa) {
+    return static_cast<int>(isa) <= static_cast<int>(detectIsa());
+}
+
+ThermoKernels::Isa ThermoKernels::activeIsa() {
+    int isa = isaSetting().load(std::memory_order_relaxed);
+    if (isa < 0) {
+        isa = static_cast<int>(detectIsa());
+        isaSetting().store(isa, std::memory_order_relaxed);
+    }
+    return static_cast<Isa>(isa);
+}
+
+ThermoKernels::Isa ThermoKernels::setIsa(Isa isa) {
+    while (!isSupported(isa)) {
+        isa = static_cast<Isa>(static_cast<int>(isa) - 1);
+    }
+    isaSetting().store(static_cast<int>(isa), std::memory_order_relaxed);
+    return isa;
+}
+
+const char* ThermoKernels::isaName(Isa isa) {
+    switch (isa) {
+    case Isa::AVX2: return "AVX2";
+    case Isa::AVX512: return "AVX-512";
+    default: return "scalar";
+    }
+}
+
+void ThermoKernels::evaluate(const Nasa7Table& table, double T, double* h_RT, double* s_R, double* cp_R) {
+    evaluate(activeIsa(), table, T, h_RT, s_R, cp_R, nullptr);
+}
+
+void ThermoKernels::evaluate(Isa isa, const Nasa7Table& table, double T, double* h_RT, double* s_R, double* cp_R) {
+    evaluate(isa, table, T, h_RT, s_R, cp_R, nullptr);
+}
+
+void ThermoKernels::evaluate(const Nasa7Table& table, double T, double* h_RT, double* s_R, double* cp_R,
+    double* dcp_R) {
+    evaluate(activeIsa(), table, T, h_RT, s_R, cp_R, dcp_R);
+}
+
+void ThermoKernels::evaluate(Isa isa, const Nasa7Table& table, double T, double* h_RT, double* s_R, double* cp_R,
+    double* dcp_R) {
+    // ln(T) 对所有组分只算一次
+    double logT = std::log(T);
+    const double* coeffs = table.coeffData();
+    const double* Tmid = table.TmidData();
+    size_t n = table.nSpecies();
+    size_t stride = table.paddedSize();
+
+    if (!isSupported(isa)) isa = detectIsa();
+    switch (isa) {
+#ifdef IDEALGAS_X86_SIMD
+    case Isa::AVX512:
+        nasa7KernelAvx512(coeffs, Tmid, n, stride, T, logT, h_RT, s_R, cp_R, dcp_R);
+        break;
+    case Isa::AVX2:
+        nasa7KernelAvx2(coeffs, Tmid, n, stride, T, logT, h_RT, s_R, cp_R, dcp_R);
+        break;
+#endif
+    default:
+        nasa7KernelScalar(coeffs, Tmid, n, stride, T, 1.0 / T, logT, h_RT, s_R, cp_R, dcp_R);
+        break;
+    }
+    table.fillDefaults(cp_R);
+}
+
+void ThermoKernels::evaluate(const Nasa7TableF& table, double T, float* h_RT, float* s_R, float* cp_R) {
+    evaluate(activeIsa(), table, T, h_RT, s_R, cp_R);
+}
+
+void ThermoKernels::evaluate(Isa isa, const Nasa7TableF& table, double T, float* h_RT, float* s_R, float* cp_R) {
+    float fT = static_cast<float>(T);
+    float invT = static_cast<float>(1.0 / T);
+    float logT = static_cast<float>(std::log(T));
+    const float* coeffs = table.coeffData();
+    const float* Tmid = table.TmidData();
+    size_t n = table.nSpecies();
+    size_t stride = table.paddedSize();
+
+    if (!isSupported(isa)) isa = detectIsa();
+    switch (isa) {
+#ifdef IDEALGAS_X86_SIMD
+    case Isa::AVX512:
+        nasa7KernelAvx512(coeffs, Tmid, n, stride, fT, invT, logT, h_RT, s_R, cp_R);
+        break;
+    case Isa::AVX2:
+        nasa7KernelAvx2(coeffs, Tmid, n, stride, fT, invT, logT, h_RT, s_R, cp_R);
+        break;
+#endif
+    default:
+        nasa7KernelScalar(coeffs, Tmid, n, stride, fT, invT, logT, h_RT, s_R, cp_R, static_cast<float*>(nullptr));
+        break;
+    }
+    table.fillDefaults(cp_R);
+}
+
+void ThermoKernels::evaluate(const Nasa9Table& table, double T, double* h_RT, double* s_R, double* cp_R) {
+    evaluate(activeIsa(), table, T, h_RT, s_R, cp_R, nullptr);
+}
+
+void ThermoKernels::evaluate(Isa isa, const Nasa9Table& table, double T, double* h_RT, double* s_R, double* cp_R) {
+    evaluate(isa, table, T, h_RT, s_R, cp_R, nullptr);
+}
+
+void ThermoKernels::evaluate(const Nasa9Table& table, double T, double* h_RT, double* s_R, double* cp_R,
+    double* dcp_R) {
+    evaluate(activeIsa(), table, T, h_RT, s_R, cp_R, dcp_R);
+}
+
+void ThermoKernels::evaluate(Isa isa, const Nasa9Table& table, double T, double* h_RT, double* s_R, double* cp_R,
+    double* dcp_R) {
+    double logT = std::log(T);
+    const double* coeffs = table.coeffData();
+    const double* Tmin = table.TminData();
+    size_t nRanges = table.nRanges();
+    size_t n = table.nSpecies();
+    size_t stride = table.paddedSize();
+
+    if (!isSupported(isa)) isa = detectIsa();
+    switch (isa) {
+#ifdef IDEALGAS_X86_SIMD
+    case Isa::AVX512:
+        nasa9KernelAvx512(coeffs, Tmin, nRanges, n, stride, T, logT, h_RT, s_R, cp_R, dcp_R);
+        break;
+    case Isa::AVX2:
+        nasa9KernelAvx2(coeffs, Tmin, nRanges, n, stride, T, logT, h_RT, s_R, cp_R, dcp_R);
+        break;
+#endif
+    default:
+        nasa9KernelScalar(coeffs, Tmin, nRanges, n, stride, T, logT, h_RT, s_R, cp_R, dcp_R);
+        break;
+    }
+}
+
+void ThermoKernels::invertEnthalpy(Isa isa, const double* coeffs, size_t stride, const double* groupTmid,
+    size_t nGroups, size_t n, const double* target, double* T, int* iterations,
+    double Tmin, double Tmax, int maxIterations) {
+    if (!isSupported(isa)) isa = detectIsa();
+    switch (isa) {
+#ifdef IDEALGAS_X86_SIMD
+    case Isa::AVX512:
+        invertEnthalpyAvx512(coeffs, stride, groupTmid, nGroups, n, target, T, iterations, Tmin, Tmax, maxIterations);
+        break;
+    case Isa::AVX2:
+        invertEnthalpyAvx2(coeffs, stride, groupTmid, nGroups, n, target, T, iterations, Tmin, Tmax, maxIterations);
+        break;
+#endif
+    default:
+        invertEnthalpyScalar(coeffs, stride, groupTmid, nGroups, n, target, T, iterations, Tmin, Tmax, maxIterations);
+        break;
+    }
+}
@@ -0,0 +1,149 @@
+#pragma once
+#include "AlignedAllocator.h"
+#include "ChemistryVars.h"
+#include <string>
+#include <vector>
+
+// NASA7系数表 - 初始化时建立一次, 求值时不再访问ThermoData
+// 布局: 每个 (温度区间, 系数行) 是一个按组分连续存放的数组 [range][RowsPerRange][paddedSize],
+// 长度补齐到SIMD块宽度, 内核一次加载相邻几个组分的同一系数
+// 除原始的a0..a6外还保存预先除好的h/RT、s/R系数, 标量求值时三个性质都是纯Horner多项式, 没有除法
+// (SIMD内核只读原始系数行, 在寄存器中乘常数倒数, 比多读7行系数更快)
+// Real为系数类型: Nasa7Table (double) 为默认路径; Nasa7TableF (float) 的系数由双精度值舍入,
+// 内存占用减半, 一个SIMD寄存器处理两倍的组分
+template <typename Real>
+class BasicNasa7Table {
+public:
+    static const size_t BlockSize = 64 / sizeof(Real);  // 补齐宽度 (一个AVX-512寄存器的元素数)
+
+    // 每个温度区间的系数行
+    enum Row {
+        A0, A1, A2, A3, A4, A5, A6,         // 原始系数 (cp/R直接使用a0..a4)
+        H1, H2, H3, H4,                     // a1/2, a2/3, a3/4, a4/5
+        S2, S3, S4,                         // a2/2, a3/3, a4/4
+        RowsPerRange
+    };
+
+    BasicNasa7Table() = default;
+    explicit BasicNasa7Table(const std::vector<ChemistryVars::ThermoData>& species);
+
+    size_t nSpecies() const { return m_nSpecies; }
+    size_t paddedSize() const { return m_padded; }
+
+    // range: 0 = 低温区间, 1 = 高温区间; c 为Row (0..6 是原始系数)
+    Real coeff(size_t k, int range, int c) const { return m_coeffs[(range * RowsPerRange + c) * m_padded + k]; }
+    // T > Tmid 时使用高温区间系数
+    Real Tmid(size_t k) const { return m_Tmid[k]; }
+
+    const Real* coeffData() const { return m_coeffs.data(); }
+    const Real* TmidData() const { return m_Tmid.data(); }
+
+    // 只有一个温度区间的组分两个区间使用相同系数; 没有NASA7数据的组分系数为0,
+    // 求值结果与SpeciesThermo的默认值相同: h/RT = s/R = 0, cp/R = 3.5
+    // (有NASA9数据的组分由Nasa9Table计算, 这里不作为NASA7组分)
+    bool hasNasa7(size_t k) const { return m_hasData[k] != 0; }
+    // 内核求值后把没有NASA7数据的组分的cp/R设为3.5
+    void fillDefaults(Real* cp_R) const;
+
+    // 单个组分的融合求值 (与内核使用相同的预缩放系数)
+    void evaluate(size_t k, Real T, Real& h_RT, Real& s_R, Real& cp_R) const;
+
+private:
+    size_t m_nSpecies = 0;
+    size_t m_padded = 0;
+    AlignedVector<Real> m_coeffs;
+    AlignedVector<Real> m_Tmid;
+    std::vector<char> m_hasData;
+    std::vector<size_t> m_noData;               // 没有NASA7数据的组分
+};
+
+typedef BasicNasa7Table<double> Nasa7Table;
+typedef BasicNasa7Table<float> Nasa7TableF;
+
+// NASA9系数表 - 只包含有NASA9数据的组分, 每个组分可以有任意个温度区间
+// 布局: [range][9][paddedSize], 区间数取所有组分的最大值;
+// m_Tmin[range][paddedSize] 为各区间下限, 组分区间数不足时填DBL_MAX, 区间选择不需要分支
+class Nasa9Table {
+public:
+    static const size_t BlockSize = Nasa7Table::BlockSize;
+    static const int NCoeffs = 9;
+
+    Nasa9Table() = default;
+    explicit Nasa9Table(const std::vector<ChemistryVars::ThermoData>& species);
+
+    // 组分是否有完整的NASA9数据 (每个区间2个温度点、9个系数)
+    static bool hasNasa9(const ChemistryVars::ThermoData& thermo);
+
+    // 表中第j个组分对应原组分列表中的序号
+    size_t nSpecies() const { return m_species.size(); }
+    size_t speciesIndex(size_t j) const { return m_species[j]; }
+    size_t paddedSize() const { return m_padded; }
+    size_t nRanges() const { return m_nRanges; }
+
+    // 区间按温度升高排序; 低于第一个区间或高于最后一个区间时外推
+    double coeff(size_t j, size_t range, int c) const { return m_coeffs[(range * NCoeffs + c) * m_padded + j]; }
+    double Tmin(size_t j, size_t range) const { return m_Tmin[range * m_padded + j]; }
+
+    const double* coeffData() const { return m_coeffs.data(); }
+    const double* TminData() const { return m_Tmin.data(); }
+
+    // 单个组分的融合求值
+    void evaluate(size_t j, double T, double& h_RT, double& s_R, double& cp_R) const;
+
+private:
+    size_t m_padded = 0;
+    size_t m_nRanges = 0;
+    std::vector<size_t> m_species;
+    AlignedVector<double> m_coeffs;
+    AlignedVector<double> m_Tmin;
+};
+
+// 热力学内核 - 一次遍历全部组分计算 h/RT、s/R、cp/R (可选 d(cp/R)/dT)
+// T的各次幂和ln(T)只计算一次; 按运行时检测到的指令集选择实现
+class ThermoKernels {
+public:
+    enum class Isa {
+        Scalar,
+        AVX2,       // AVX2 + FMA
+        AVX512      // AVX-512F
+    };
+
+    // CPU支持的最高指令集
+    static Isa detectIsa();
+    // 当前使用的指令集 (默认为detectIsa())
+    static Isa activeIsa();
+    // 指定指令集 (用于测试和基准), 超出CPU支持范围时降为支持的最高指令集, 返回实际使用的指令集
+    static Isa setIsa(Isa isa);
+    static bool isSupported(Isa isa);
+    static const char* isaName(Isa isa);
+
+    // 计算全部组分的无量纲参考态性质, 输出数组长度至少为nSpecies
+    static void evaluate(const Nasa7Table& table, double T, double* h_RT, double* s_R, double* cp_R);
+    static void evaluate(Isa isa, const Nasa7Table& table, double T, double* h_RT, double* s_R, double* cp_R);
+
+    // NASA9表求值, 输出按表内顺序 (长度nSpecies, 用speciesIndex映射回原组分)
+    static void evaluate(const Nasa9Table& table, double T, double* h_RT, double* s_R, double* cp_R);
+    static void evaluate(Isa isa, const Nasa9Table& table, double T, double* h_RT, double* s_R, double* cp_R);
+
+    // 同时计算 d(cp/R)/dT (1/K), 与性质在同一次遍历中完成 (dcp_R为空时等同于上面的函数)
+    // 其余导数由性质直接得到: d(h/RT)/dT = (cp/R - h/RT)/T, d(s/R)/dT = (cp/R)/T
+    static void evaluate(const Nasa7Table& table, double T, double* h_RT, double* s_R, double* cp_R, double* dcp_R);
+    static void evaluate(Isa isa, const Nasa7Table& table, double T, double* h_RT, double* s_R, double* cp_R,
+        double* dcp_R);
+    static void evaluate(const Nasa9Table& table, double T, double* h_RT, double* s_R, double* cp_R, double* dcp_R);
+    static void evaluate(Isa isa, const Nasa9Table& table, double T, double* h_RT, double* s_R, double* cp_R,
+        double* dcp_R);
+
+    // 单精度NASA7表求值 (AVX2一次8个组分, AVX-512一次16个); ln(T)和1/T在双精度下计算后舍入
+    static void evaluate(const Nasa7TableF& table, double T, float* h_RT, float* s_R, float* cp_R);
+    static void evaluate(Isa isa, const Nasa7TableF& table, double T, float* h_RT, float* s_R, float* cp_R);
+
+    // 批量反求温度: n个通道 (状态) 各有一个按Tmid分组的混合物焓多项式, 每组低温/高温各6个系数
+    // H/R = c0 + T(c1 + T(c2 + T(c3 + T(c4 + T c5)))), 系数 coeffs[((g*2 + range)*6 + j)*stride + l]
+    // 各通道同步迭代 (Newton + Halley修正, 越出 [lo, hi] 时二分), 已收敛的通道被屏蔽
+    // T 输入初值、输出结果; iterations[l] 为多项式计算次数, 未收敛记为 maxIterations + 1
+    // stride 及 target/T/iterations 的长度要补齐到 Nasa7Table::BlockSize 的倍数
+    static void invertEnthalpy(Isa isa, const double* coeffs, size_t stride, const double* groupTmid,
+        size_t nGroups, size_t n, const double* target, double* T, int* iterations,
+        double Tmin, double Tmax, int maxIterations);
+};
@@ -0,0 +1,334 @@
+// AVX2 + FMA 内核, 本文件以 -mavx2 -mfma (/arch:AVX2) 单独编译
+// 只能由 ThermoKernels.cpp 在运行时确认CPU支持后调用
+#include <cstddef>
+#include <immintrin.h>
+
+namespace {
+
+const int kRows = 14;     // 每个温度区间的系数行数, 与 Nasa7Table::RowsPerRange 一致
+const int kH1 = 7;        // 预除的h/RT系数行 H1..H4 的起始行, 与 Nasa7Table::H1 一致
+const int kS2 = 11;       // 预除的s/R系数行 S2..S4 的起始行, 与 Nasa7Table::S2 一致
+
+inline void nasa7One(const double* lo, const double* hi, const double* Tmid, size_t k, size_t stride,
+    double T, double invT, double logT, double* h_RT, double* s_R, double* cp_R, double* dcp_R) {
+    const double* a = (T > Tmid[k] ? hi : lo) + k;
+    double a0 = a[0], a1 = a[stride], a2 = a[2 * stride], a3 = a[3 * stride];
+    double a4 = a[4 * stride], a5 = a[5 * stride], a6 = a[6 * stride];
+
+    cp_R[k] = a0 + T * (a1 + T * (a2 + T * (a3 + T * a4)));
+    h_RT[k] = a0 + T * (a1 * 0.5 + T * (a2 * (1.0 / 3.0) + T * (a3 * 0.25 + T * a4 * 0.2))) + a5 * invT;
+    s_R[k] = a0 * logT + T * (a1 + T * (a2 * 0.5 + T * (a3 * (1.0 / 3.0) + T * a4 * 0.25))) + a6;
+    if (dcp_R) dcp_R[k] = a1 + T * (2.0 * a2 + T * (3.0 * a3 + T * 4.0 * a4));
+}
+
+} // namespace
+
+void nasa7KernelAvx2(const double* coeffs, const double* Tmid, size_t n, size_t stride,
+    double T, double logT, double* h_RT, double* s_R, double* cp_R, double* dcp_R) {
+    const double invT = 1.0 / T;
+    const double* lo = coeffs;
+    const double* hi = coeffs + kRows * stride;
+
+    const __m256d vT = _mm256_set1_pd(T);
+    const __m256d vInvT = _mm256_set1_pd(invT);
+    const __m256d vLogT = _mm256_set1_pd(logT);
+    const __m256d c2 = _mm256_set1_pd(0.5);
+    const __m256d c3 = _mm256_set1_pd(1.0 / 3.0);
+    const __m256d c4 = _mm256_set1_pd(0.25);
+    const __m256d c5 = _mm256_set1_pd(0.2);
+    const __m256d two = _mm256_set1_pd(2.0);
+    const __m256d three = _mm256_set1_pd(3.0);
+    const __m256d four = _mm256_set1_pd(4.0);
+
+    size_t k = 0;
+    for (; k + 4 <= n; k += 4) {
+        // 按组分选择温度区间: T > Tmid 的通道取高温系数
+        __m256d high = _mm256_cmp_pd(vT, _mm256_load_pd(Tmid + k), _CMP_GT_OQ);
+        __m256d a[7];
+        for (int c = 0; c < 7; ++c) {
+            a[c] = _mm256_blendv_pd(_mm256_load_pd(lo + c * stride + k),
+                _mm256_load_pd(hi + c * stride + k), high);
+        }
+
+        __m256d cp = _mm256_fmadd_pd(vT, a[4], a[3]);
+        cp = _mm256_fmadd_pd(vT, cp, a[2]);
+        cp = _mm256_fmadd_pd(vT, cp, a[1]);
+        cp = _mm256_fmadd_pd(vT, cp, a[0]);
+
+        __m256d h = _mm256_fmadd_pd(vT, _mm256_mul_pd(a[4], c5), _mm256_mul_pd(a[3], c4));
+        h = _mm256_fmadd_pd(vT, h, _mm256_mul_pd(a[2], c3));
+        h = _mm256_fmadd_pd(vT, h, _mm256_mul_pd(a[1], c2));
+        h = _mm256_fmadd_pd(vT, h, a[0]);
+        h = _mm256_fmadd_pd(a[5], vInvT, h);
+
+        __m256d s = _mm256_fmadd_pd(vT, _mm256_mul_pd(a[4], c4), _mm256_mul_pd(a[3], c3));
+        s = _mm256_fmadd_pd(vT, s, _mm256_mul_pd(a[2], c2));
+        s = _mm256_fmadd_pd(vT, s, a[1]);
+        s = _mm256_mul_pd(vT, s);
+        s = _mm256_fmadd_pd(a[0], vLogT, s);
+        s = _mm256_add_pd(s, a[6]);
+
+        _mm256_storeu_pd(cp_R + k, cp);
+        _mm256_storeu_pd(h_RT + k, h);
+        _mm256_storeu_pd(s_R + k, s);
+
+        if (dcp_R) {
+            __m256d d = _mm256_fmadd_pd(vT, _mm256_mul_pd(a[4], four), _mm256_mul_pd(a[3], three));
+            d = _mm256_fmadd_pd(vT, d, _mm256_mul_pd(a[2], two));
+            d = _mm256_fmadd_pd(vT, d, a[1]);
+            _mm256_storeu_pd(dcp_R + k, d);
+        }
+    }
+    for (; k < n; ++k) {
+        nasa7One(lo, hi, Tmid, k, stride, T, invT, logT, h_RT, s_R, cp_R, dcp_R);
+    }
+}
+
+namespace {
+
+// 单精度的乘加分开舍入 (不用FMA), 与不带FMA编译的标量内核逐位相同
+inline __m256 mulAddF(__m256 a, __m256 b, __m256 c) {
+    return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+}
+
+} // namespace
+
+// 单精度: 一次8个组分, 读取表中预除好的h/RT、s/R系数行, 运算顺序和舍入与标量内核相同
+// (单精度下在寄存器中乘常数倒数或使用FMA都会改变舍入, 焓的相消使差别放大到1e-5量级);
+// 系数表补齐到16的倍数, 最后一块用掩码存储, 不需要标量尾循环
+void nasa7KernelAvx2(const float* coeffs, const float* Tmid, size_t n, size_t stride,
+    float T, float invT, float logT, float* h_RT, float* s_R, float* cp_R) {
+    const float* lo = coeffs;
+    const float* hi = coeffs + kRows * stride;
+
+    const __m256 vT = _mm256_set1_ps(T);
+    const __m256 vInvT = _mm256_set1_ps(invT);
+    const __m256 vLogT = _mm256_set1_ps(logT);
+    const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+    for (size_t k = 0; k < n; k += 8) {
+        int remaining = n - k >= 8 ? 8 : static_cast<int>(n - k);
+        __m256i store = _mm256_cmpgt_epi32(_mm256_set1_epi32(remaining), lane);
+
+        __m256 high = _mm256_cmp_ps(vT, _mm256_load_ps(Tmid + k), _CMP_GT_OQ);
+        __m256 a[kRows];
+        for (int c = 0; c < kRows; ++c) {
+            a[c] = _mm256_blendv_ps(_mm256_load_ps(lo + c * stride + k),
+                _mm256_load_ps(hi + c * stride + k), high);
+        }
+
+        __m256 cp = mulAddF(vT, a[4], a[3]);
+        cp = mulAddF(vT, cp, a[2]);
+        cp = mulAddF(vT, cp, a[1]);
+        cp = mulAddF(vT, cp, a[0]);
+
+        __m256 h = mulAddF(vT, a[kH1 + 3], a[kH1 + 2]);
+        h = mulAddF(vT, h, a[kH1 + 1]);
+        h = mulAddF(vT, h, a[kH1]);
+        h = mulAddF(vT, h, a[0]);
+        h = mulAddF(a[5], vInvT, h);
+
+        __m256 s = mulAddF(vT, a[kS2 + 2], a[kS2 + 1]);
+        s = mulAddF(vT, s, a[kS2]);
+        s = mulAddF(vT, s, a[1]);
+        s = _mm256_mul_ps(vT, s);
+        s = mulAddF(a[0], vLogT, s);
+        s = _mm256_add_ps(s, a[6]);
+
+        _mm256_maskstore_ps(cp_R + k, store, cp);
+        _mm256_maskstore_ps(h_RT + k, store, h);
+        _mm256_maskstore_ps(s_R + k, store, s);
+    }
+}
+
+namespace {
+
+inline void nasa9One(const double* coeffs, const double* Tmin, size_t nRanges, size_t k, size_t stride,
+    double T, double invT, double logT, double* h_RT, double* s_R, double* cp_R, double* dcp_R) {
+    size_t range = 0;
+    for (size_t r = 1; r < nRanges; ++r) {
+        range += T > Tmin[r * stride + k] ? 1 : 0;
+    }
+    const double* a = coeffs + range * 9 * stride + k;
+    double a0 = a[0], a1 = a[stride], a2 = a[2 * stride], a3 = a[3 * stride], a4 = a[4 * stride];
+    double a5 = a[5 * stride], a6 = a[6 * stride], a7 = a[7 * stride], a8 = a[8 * stride];
+    double invT2 = invT * invT;
+
+    cp_R[k] = a0 * invT2 + a1 * invT + a2 + T * (a3 + T * (a4 + T * (a5 + T * a6)));
+    h_RT[k] = -a0 * invT2 + (a1 * logT + a7) * invT + a2 +
+        T * (a3 * 0.5 + T * (a4 * (1.0 / 3.0) + T * (a5 * 0.25 + T * a6 * 0.2)));
+    s_R[k] = -0.5 * a0 * invT2 - a1 * invT + a2 * logT + a8 +
+        T * (a3 + T * (a4 * 0.5 + T * (a5 * (1.0 / 3.0) + T * a6 * 0.25)));
+    if (dcp_R) {
+        dcp_R[k] = -(2.0 * a0 * invT + a1) * invT2 + a3 + T * (2.0 * a4 + T * (3.0 * a5 + T * 4.0 * a6));
+    }
+}
+
+} // namespace
+
+void nasa9KernelAvx2(const double* coeffs, const double* Tmin, size_t nRanges, size_t n, size_t stride,
+    double T, double logT, double* h_RT, double* s_R, double* cp_R, double* dcp_R) {
+    const double invT = 1.0 / T;
+
+    const __m256d vT = _mm256_set1_pd(T);
+    const __m256d vInvT = _mm256_set1_pd(invT);
+    const __m256d vInvT2 = _mm256_set1_pd(invT * invT);
+    const __m256d vLogT = _mm256_set1_pd(logT);
+    const __m256d c2 = _mm256_set1_pd(0.5);
+    const __m256d c3 = _mm256_set1_pd(1.0 / 3.0);
+    const __m256d c4 = _mm256_set1_pd(0.25);
+    const __m256d c5 = _mm256_set1_pd(0.2);
+    const __m256d two = _mm256_set1_pd(2.0);
+    const __m256d three = _mm256_set1_pd(3.0);
+    const __m256d four = _mm256_set1_pd(4.0);
+
+    size_t k = 0;
+    for (; k + 4 <= n; k += 4) {
+        // 从第一个区间开始, 依次用 T > Tmin 的区间覆盖 (区间按温度排序)
+        __m256d a[9];
+        for (int c = 0; c < 9; ++c) {
+            a[c] = _mm256_load_pd(coeffs + c * stride + k);
+        }
+        for (size_t r = 1; r < nRanges; ++r) {
+            __m256d above = _mm256_cmp_pd(vT, _mm256_load_pd(Tmin + r * stride + k), _CMP_GT_OQ);
+            const double* ar = coeffs + r * 9 * stride + k;
+            for (int c = 0; c < 9; ++c) {
+                a[c] = _mm256_blendv_pd(a[c], _mm256_load_pd(ar + c * stride), above);
+            }
+        }
+
+        __m256d poly = _mm256_fmadd_pd(vT, a[6], a[5]);
+        poly = _mm256_fmadd_pd(vT, poly, a[4]);
+        poly = _mm256_fmadd_pd(vT, poly, a[3]);
+        __m256d cp = _mm256_fmadd_pd(vT, poly, a[2]);
+        cp = _mm256_fmadd_pd(a[1], vInvT, cp);
+        cp = _mm256_fmadd_pd(a[0], vInvT2, cp);
+
+        __m256d h = _mm256_fmadd_pd(vT, _mm256_mul_pd(a[6], c5), _mm256_mul_pd(a[5], c4));
+        h = _mm256_fmadd_pd(vT, h, _mm256_mul_pd(a[4], c3));
+        h = _mm256_fmadd_pd(vT, h, _mm256_mul_pd(a[3], c2));
+        h = _mm256_fmadd_pd(vT, h, a[2]);
+        h = _mm256_fmadd_pd(_mm256_fmadd_pd(a[1], vLogT, a[7]), vInvT, h);
+        h = _mm256_fnmadd_pd(a[0], vInvT2, h);
+
+        __m256d s = _mm256_fmadd_pd(vT, _mm256_mul_pd(a[6], c4), _mm256_mul_pd(a[5], c3));
+        s = _mm256_fmadd_pd(vT, s, _mm256_mul_pd(a[4], c2));
+        s = _mm256_fmadd_pd(vT, s, a[3]);
+        s = _mm256_mul_pd(vT, s);
+        s = _mm256_fmadd_pd(a[2], vLogT, s);
+        s = _mm256_add_pd(s, a[8]);
+        s = _mm256_fnmadd_pd(a[1], vInvT, s);
+        s = _mm256_fnmadd_pd(_mm256_mul_pd(a[0], c2), vInvT2, s);
+
+        _mm256_storeu_pd(cp_R + k, cp);
+        _mm256_storeu_pd(h_RT + k, h);
+        _mm256_storeu_pd(s_R + k, s);
+
+        if (dcp_R) {
+            __m256d d = _mm256_fmadd_pd(vT, _mm256_mul_pd(a[6], four), _mm256_mul_pd(a[5], three));
+            d = _mm256_fmadd_pd(vT, d, _mm256_mul_pd(a[4], two));
+            d = _mm256_fmadd_pd(vT, d, a[3]);
+            d = _mm256_fnmadd_pd(_mm256_fmadd_pd(_mm256_mul_pd(a[0], two), vInvT, a[1]), vInvT2, d);
+            _mm256_storeu_pd(dcp_R + k, d);
+        }
+    }
+    for (; k < n; ++k) {
+        nasa9One(coeffs, Tmin, nRanges, k, stride, T, invT, logT, h_RT, s_R, cp_R, dcp_R);
+    }
+}
+
+void invertEnthalpyAvx2(const double* coeffs, size_t stride, const double* groupTmid, size_t nGroups, size_t n,
+    const double* target, double* T, int* iterations, double Tmin, double Tmax, int maxIterations) {
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d half = _mm256_set1_pd(0.5);
+    const __m256d two = _mm256_set1_pd(2.0);
+    const __m256d three = _mm256_set1_pd(3.0);
+    const __m256d four = _mm256_set1_pd(4.0);
+    const __m256d five = _mm256_set1_pd(5.0);
+    const __m256d six = _mm256_set1_pd(6.0);
+    const __m256d twelve = _mm256_set1_pd(12.0);
+    const __m256d twenty = _mm256_set1_pd(20.0);
+    const __m256d vTmin = _mm256_set1_pd(Tmin);
+    const __m256d vTmax = _mm256_set1_pd(Tmax);
+    const __m256d stepTol = _mm256_set1_pd(1e-9);
+    const __m256d widthTol = _mm256_set1_pd(1e-14);
+    const __m256d absMask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+    const __m256d laneIndex = _mm256_set_pd(3.0, 2.0, 1.0, 0.0);
+
+    for (size_t l = 0; l < n; l += 4) {
+        const __m256d lanes = _mm256_cmp_pd(laneIndex, _mm256_set1_pd(static_cast<double>(n - l)), _CMP_LT_OQ);
+        __m256d active = lanes;
+        __m256d failed = zero;
+        const __m256d tgt = _mm256_loadu_pd(target + l);
+        __m256d t = _mm256_min_pd(_mm256_max_pd(_mm256_loadu_pd(T + l), vTmin), vTmax);
+        __m256d lo = vTmin, hi = vTmax;
+        __m256d count = zero;
+
+        // 所有通道同步迭代, 已收敛的通道不再更新
+        for (int it = 0; it < maxIterations && _mm256_movemask_pd(active); ++it) {
+            __m256d H = zero, cp = zero, dcp = zero;
+            for (size_t g = 0; g < nGroups; ++g) {
+                __m256d high = _mm256_cmp_pd(t, _mm256_set1_pd(groupTmid[g]), _CMP_GT_OQ);
+                const double* cl = coeffs + g * 12 * stride + l;
+                const double* ch = cl + 6 * stride;
+                __m256d c[6];
+                for (int j = 0; j < 6; ++j) {
+                    c[j] = _mm256_blendv_pd(_mm256_loadu_pd(cl + j * stride), _mm256_loadu_pd(ch + j * stride), high);
+                }
+                __m256d h = _mm256_fmadd_pd(t, c[5], c[4]);
+                h = _mm256_fmadd_pd(t, h, c[3]);
+                h = _mm256_fmadd_pd(t, h, c[2]);
+                h = _mm256_fmadd_pd(t, h, c[1]);
+                H = _mm256_add_pd(H, _mm256_fmadd_pd(t, h, c[0]));
+
+                __m256d d = _mm256_fmadd_pd(t, _mm256_mul_pd(five, c[5]), _mm256_mul_pd(four, c[4]));
+                d = _mm256_fmadd_pd(t, d, _mm256_mul_pd(three, c[3]));
+                d = _mm256_fmadd_pd(t, d, _mm256_mul_pd(two, c[2]));
+                cp = _mm256_add_pd(cp, _mm256_fmadd_pd(t, d, c[1]));
+
+                __m256d d2 = _mm256_fmadd_pd(t, _mm256_mul_pd(twenty, c[5]), _mm256_mul_pd(twelve, c[4]));
+                d2 = _mm256_fmadd_pd(t, d2, _mm256_mul_pd(six, c[3]));
+                dcp = _mm256_add_pd(dcp, _mm256_fmadd_pd(t, d2, _mm256_mul_pd(two, c[2])));
+            }
+
+            __m256d r = _mm256_sub_pd(H, tgt);
+            __m256d exact = _mm256_and_pd(active, _mm256_cmp_pd(r, zero, _CMP_EQ_OQ));
+            __m256d below = _mm256_and_pd(active, _mm256_cmp_pd(r, zero, _CMP_LT_OQ));
+            lo = _mm256_blendv_pd(lo, t, below);
+            hi = _mm256_blendv_pd(hi, t, _mm256_andnot_pd(below, active));
+
+            // Halley修正的Newton步; 导数异常或越出区间的通道二分
+            __m256d step = _mm256_div_pd(r, cp);
+            __m256d correction = _mm256_fnmadd_pd(_mm256_mul_pd(half, step), _mm256_div_pd(dcp, cp), one);
+            step = _mm256_blendv_pd(step, _mm256_div_pd(step, correction), _mm256_cmp_pd(correction, half, _CMP_GT_OQ));
+            __m256d tn = _mm256_sub_pd(t, step);
+            __m256d small = _mm256_cmp_pd(_mm256_and_pd(step, absMask), _mm256_mul_pd(stepTol, t), _CMP_LE_OQ);
+            __m256d newton = _mm256_and_pd(_mm256_cmp_pd(cp, zero, _CMP_GT_OQ), _mm256_or_pd(small,
+                _mm256_and_pd(_mm256_cmp_pd(tn, lo, _CMP_GT_OQ), _mm256_cmp_pd(tn, hi, _CMP_LT_OQ))));
+            __m256d mid = _mm256_mul_pd(half, _mm256_add_pd(lo, hi));
+            tn = _mm256_blendv_pd(mid, tn, newton);
+
+            // 步长小于容差时直接接受 (舍入后可能落在区间端点上)
+            __m256d stepDone = _mm256_and_pd(newton, small);
+            __m256d widthDone = _mm256_andnot_pd(newton, _mm256_cmp_pd(_mm256_sub_pd(hi, lo),
+                _mm256_mul_pd(widthTol, mid), _CMP_LE_OQ));
+            __m256d boundary = _mm256_or_pd(_mm256_cmp_pd(lo, vTmin, _CMP_EQ_OQ), _mm256_cmp_pd(hi, vTmax, _CMP_EQ_OQ));
+            failed = _mm256_or_pd(failed, _mm256_andnot_pd(exact, _mm256_and_pd(active, _mm256_and_pd(widthDone, boundary))));
+
+            tn = _mm256_blendv_pd(tn, t, exact);
+            t = _mm256_blendv_pd(t, tn, active);
+            count = _mm256_add_pd(count, _mm256_and_pd(active, one));
+            active = _mm256_andnot_pd(_mm256_or_pd(_mm256_or_pd(stepDone, widthDone), exact), active);
+        }
+        failed = _mm256_or_pd(failed, active);
+
+        _mm256_storeu_pd(T + l, _mm256_blendv_pd(_mm256_loadu_pd(T + l), t, lanes));
+        alignas(32) double counts[4];
+        _mm256_store_pd(counts, count);
+        int failedBits = _mm256_movemask_pd(failed);
+        for (size_t j = 0; j < 4 && l + j < n; ++j) {
+            iterations[l + j] = (failedBits >> j) & 1 ? maxIterations + 1 : static_cast<int>(counts[j]);
+        }
+    }
+}
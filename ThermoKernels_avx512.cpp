@@ -0,0 +1,284 @@
+// AVX-512F 内核, 本文件以 -mavx512f (/arch:AVX512) 单独编译
+// 只能由 ThermoKernels.cpp 在运行时确认CPU支持后调用
+#include <cstddef>
+#include <immintrin.h>
+
+namespace {
+
+const int kRows = 14;     // 每个温度区间的系数行数, 与 Nasa7Table::RowsPerRange 一致
+const int kH1 = 7;        // 预除的h/RT系数行 H1..H4 的起始行, 与 Nasa7Table::H1 一致
+const int kS2 = 11;       // 预除的s/R系数行 S2..S4 的起始行, 与 Nasa7Table::S2 一致
+
+// 单精度的乘加 (不用FMA)
+inline __m512 mulAddF(__m512 a, __m512 b, __m512 c) {
+    return _mm512_add_ps(_mm512_mul_ps(a, b), c);
+}
+
+} // namespace
+
+void nasa7KernelAvx512(const double* coeffs, const double* Tmid, size_t n, size_t stride,
+    double T, double logT, double* h_RT, double* s_R, double* cp_R, double* dcp_R) {
+    const double* lo = coeffs;
+    const double* hi = coeffs + kRows * stride;
+
+    const __m512d vT = _mm512_set1_pd(T);
+    const __m512d vInvT = _mm512_set1_pd(1.0 / T);
+    const __m512d vLogT = _mm512_set1_pd(logT);
+    const __m512d c2 = _mm512_set1_pd(0.5);
+    const __m512d c3 = _mm512_set1_pd(1.0 / 3.0);
+    const __m512d c4 = _mm512_set1_pd(0.25);
+    const __m512d c5 = _mm512_set1_pd(0.2);
+    const __m512d two = _mm512_set1_pd(2.0);
+    const __m512d three = _mm512_set1_pd(3.0);
+    const __m512d four = _mm512_set1_pd(4.0);
+
+    // 系数表补齐到8的倍数, 最后一块可以整块读取, 只需屏蔽写出
+    for (size_t k = 0; k < n; k += 8) {
+        __mmask8 store = n - k >= 8 ? static_cast<__mmask8>(0xFF) : static_cast<__mmask8>((1u << (n - k)) - 1);
+
+        __mmask8 high = _mm512_cmp_pd_mask(vT, _mm512_load_pd(Tmid + k), _CMP_GT_OQ);
+        __m512d a[7];
+        for (int c = 0; c < 7; ++c) {
+            a[c] = _mm512_mask_blend_pd(high, _mm512_load_pd(lo + c * stride + k),
+                _mm512_load_pd(hi + c * stride + k));
+        }
+
+        __m512d cp = _mm512_fmadd_pd(vT, a[4], a[3]);
+        cp = _mm512_fmadd_pd(vT, cp, a[2]);
+        cp = _mm512_fmadd_pd(vT, cp, a[1]);
+        cp = _mm512_fmadd_pd(vT, cp, a[0]);
+
+        __m512d h = _mm512_fmadd_pd(vT, _mm512_mul_pd(a[4], c5), _mm512_mul_pd(a[3], c4));
+        h = _mm512_fmadd_pd(vT, h, _mm512_mul_pd(a[2], c3));
+        h = _mm512_fmadd_pd(vT, h, _mm512_mul_pd(a[1], c2));
+        h = _mm512_fmadd_pd(vT, h, a[0]);
+        h = _mm512_fmadd_pd(a[5], vInvT, h);
+
+        __m512d s = _mm512_fmadd_pd(vT, _mm512_mul_pd(a[4], c4), _mm512_mul_pd(a[3], c3));
+        s = _mm512_fmadd_pd(vT, s, _mm512_mul_pd(a[2], c2));
+        s = _mm512_fmadd_pd(vT, s, a[1]);
+        s = _mm512_mul_pd(vT, s);
+        s = _mm512_fmadd_pd(a[0], vLogT, s);
+        s = _mm512_add_pd(s, a[6]);
+
+        _mm512_mask_storeu_pd(cp_R + k, store, cp);
+        _mm512_mask_storeu_pd(h_RT + k, store, h);
+        _mm512_mask_storeu_pd(s_R + k, store, s);
+
+        if (dcp_R) {
+            __m512d d = _mm512_fmadd_pd(vT, _mm512_mul_pd(a[4], four), _mm512_mul_pd(a[3], three));
+            d = _mm512_fmadd_pd(vT, d, _mm512_mul_pd(a[2], two));
+            d = _mm512_fmadd_pd(vT, d, a[1]);
+            _mm512_mask_storeu_pd(dcp_R + k, store, d);
+        }
+    }
+}
+
+// 单精度: 一次16个组分 (系数表补齐到16的倍数), 与AVX2相同读取预除好的系数行,
+// 乘加分开舍入, 结果与标量内核逐位相同
+void nasa7KernelAvx512(const float* coeffs, const float* Tmid, size_t n, size_t stride,
+    float T, float invT, float logT, float* h_RT, float* s_R, float* cp_R) {
+    const float* lo = coeffs;
+    const float* hi = coeffs + kRows * stride;
+
+    const __m512 vT = _mm512_set1_ps(T);
+    const __m512 vInvT = _mm512_set1_ps(invT);
+    const __m512 vLogT = _mm512_set1_ps(logT);
+
+    for (size_t k = 0; k < n; k += 16) {
+        __mmask16 store = n - k >= 16 ? static_cast<__mmask16>(0xFFFF) :
+            static_cast<__mmask16>((1u << (n - k)) - 1);
+
+        __mmask16 high = _mm512_cmp_ps_mask(vT, _mm512_load_ps(Tmid + k), _CMP_GT_OQ);
+        __m512 a[kRows];
+        for (int c = 0; c < kRows; ++c) {
+            a[c] = _mm512_mask_blend_ps(high, _mm512_load_ps(lo + c * stride + k),
+                _mm512_load_ps(hi + c * stride + k));
+        }
+
+        __m512 cp = mulAddF(vT, a[4], a[3]);
+        cp = mulAddF(vT, cp, a[2]);
+        cp = mulAddF(vT, cp, a[1]);
+        cp = mulAddF(vT, cp, a[0]);
+
+        __m512 h = mulAddF(vT, a[kH1 + 3], a[kH1 + 2]);
+        h = mulAddF(vT, h, a[kH1 + 1]);
+        h = mulAddF(vT, h, a[kH1]);
+        h = mulAddF(vT, h, a[0]);
+        h = mulAddF(a[5], vInvT, h);
+
+        __m512 s = mulAddF(vT, a[kS2 + 2], a[kS2 + 1]);
+        s = mulAddF(vT, s, a[kS2]);
+        s = mulAddF(vT, s, a[1]);
+        s = _mm512_mul_ps(vT, s);
+        s = mulAddF(a[0], vLogT, s);
+        s = _mm512_add_ps(s, a[6]);
+
+        _mm512_mask_storeu_ps(cp_R + k, store, cp);
+        _mm512_mask_storeu_ps(h_RT + k, store, h);
+        _mm512_mask_storeu_ps(s_R + k, store, s);
+    }
+}
+
+void nasa9KernelAvx512(const double* coeffs, const double* Tmin, size_t nRanges, size_t n, size_t stride,
+    double T, double logT, double* h_RT, double* s_R, double* cp_R, double* dcp_R) {
+    const double invT = 1.0 / T;
+
+    const __m512d vT = _mm512_set1_pd(T);
+    const __m512d vInvT = _mm512_set1_pd(invT);
+    const __m512d vInvT2 = _mm512_set1_pd(invT * invT);
+    const __m512d vLogT = _mm512_set1_pd(logT);
+    const __m512d c2 = _mm512_set1_pd(0.5);
+    const __m512d c3 = _mm512_set1_pd(1.0 / 3.0);
+    const __m512d c4 = _mm512_set1_pd(0.25);
+    const __m512d c5 = _mm512_set1_pd(0.2);
+    const __m512d two = _mm512_set1_pd(2.0);
+    const __m512d three = _mm512_set1_pd(3.0);
+    const __m512d four = _mm512_set1_pd(4.0);
+
+    for (size_t k = 0; k < n; k += 8) {
+        __mmask8 store = n - k >= 8 ? static_cast<__mmask8>(0xFF) : static_cast<__mmask8>((1u << (n - k)) - 1);
+
+        // 从第一个区间开始, 依次用 T > Tmin 的区间覆盖 (区间按温度排序)
+        __m512d a[9];
+        for (int c = 0; c < 9; ++c) {
+            a[c] = _mm512_load_pd(coeffs + c * stride + k);
+        }
+        for (size_t r = 1; r < nRanges; ++r) {
+            __mmask8 above = _mm512_cmp_pd_mask(vT, _mm512_load_pd(Tmin + r * stride + k), _CMP_GT_OQ);
+            const double* ar = coeffs + r * 9 * stride + k;
+            for (int c = 0; c < 9; ++c) {
+                a[c] = _mm512_mask_blend_pd(above, a[c], _mm512_load_pd(ar + c * stride));
+            }
+        }
+
+        __m512d poly = _mm512_fmadd_pd(vT, a[6], a[5]);
+        poly = _mm512_fmadd_pd(vT, poly, a[4]);
+        poly = _mm512_fmadd_pd(vT, poly, a[3]);
+        __m512d cp = _mm512_fmadd_pd(vT, poly, a[2]);
+        cp = _mm512_fmadd_pd(a[1], vInvT, cp);
+        cp = _mm512_fmadd_pd(a[0], vInvT2, cp);
+
+        __m512d h = _mm512_fmadd_pd(vT, _mm512_mul_pd(a[6], c5), _mm512_mul_pd(a[5], c4));
+        h = _mm512_fmadd_pd(vT, h, _mm512_mul_pd(a[4], c3));
+        h = _mm512_fmadd_pd(vT, h, _mm512_mul_pd(a[3], c2));
+        h = _mm512_fmadd_pd(vT, h, a[2]);
+        h = _mm512_fmadd_pd(_mm512_fmadd_pd(a[1], vLogT, a[7]), vInvT, h);
+        h = _mm512_fnmadd_pd(a[0], vInvT2, h);
+
+        __m512d s = _mm512_fmadd_pd(vT, _mm512_mul_pd(a[6], c4), _mm512_mul_pd(a[5], c3));
+        s = _mm512_fmadd_pd(vT, s, _mm512_mul_pd(a[4], c2));
+        s = _mm512_fmadd_pd(vT, s, a[3]);
+        s = _mm512_mul_pd(vT, s);
+        s = _mm512_fmadd_pd(a[2], vLogT, s);
+        s = _mm512_add_pd(s, a[8]);
+        s = _mm512_fnmadd_pd(a[1], vInvT, s);
+        s = _mm512_fnmadd_pd(_mm512_mul_pd(a[0], c2), vInvT2, s);
+
+        _mm512_mask_storeu_pd(cp_R + k, store, cp);
+        _mm512_mask_storeu_pd(h_RT + k, store, h);
+        _mm512_mask_storeu_pd(s_R + k, store, s);
+
+        if (dcp_R) {
+            __m512d d = _mm512_fmadd_pd(vT, _mm512_mul_pd(a[6], four), _mm512_mul_pd(a[5], three));
+            d = _mm512_fmadd_pd(vT, d, _mm512_mul_pd(a[4], two));
+            d = _mm512_fmadd_pd(vT, d, a[3]);
+            d = _mm512_fnmadd_pd(_mm512_fmadd_pd(_mm512_mul_pd(a[0], two), vInvT, a[1]), vInvT2, d);
+            _mm512_mask_storeu_pd(dcp_R + k, store, d);
+        }
+    }
+}
+
+void invertEnthalpyAvx512(const double* coeffs, size_t stride, const double* groupTmid, size_t nGroups, size_t n,
+    const double* target, double* T, int* iterations, double Tmin, double Tmax, int maxIterations) {
+    const __m512d zero = _mm512_setzero_pd();
+    const __m512d one = _mm512_set1_pd(1.0);
+    const __m512d half = _mm512_set1_pd(0.5);
+    const __m512d two = _mm512_set1_pd(2.0);
+    const __m512d three = _mm512_set1_pd(3.0);
+    const __m512d four = _mm512_set1_pd(4.0);
+    const __m512d five = _mm512_set1_pd(5.0);
+    const __m512d six = _mm512_set1_pd(6.0);
+    const __m512d twelve = _mm512_set1_pd(12.0);
+    const __m512d twenty = _mm512_set1_pd(20.0);
+    const __m512d vTmin = _mm512_set1_pd(Tmin);
+    const __m512d vTmax = _mm512_set1_pd(Tmax);
+    const __m512d stepTol = _mm512_set1_pd(1e-9);
+    const __m512d widthTol = _mm512_set1_pd(1e-14);
+
+    for (size_t l = 0; l < n; l += 8) {
+        const __mmask8 lanes = n - l >= 8 ? static_cast<__mmask8>(0xFF) : static_cast<__mmask8>((1u << (n - l)) - 1);
+        __mmask8 active = lanes;
+        __mmask8 failed = 0;
+        const __m512d tgt = _mm512_loadu_pd(target + l);
+        // 全掩码的maskz形式与min/max相同; 未掩码的形式以未定义向量为直通值, GCC报告可能未初始化
+        __m512d t = _mm512_maskz_min_pd(0xFF, _mm512_maskz_max_pd(0xFF, _mm512_loadu_pd(T + l), vTmin), vTmax);
+        __m512d lo = vTmin, hi = vTmax;
+        __m512d count = zero;
+
+        // 所有通道同步迭代, 已收敛的通道不再更新
+        for (int it = 0; it < maxIterations && active; ++it) {
+            __m512d H = zero, cp = zero, dcp = zero;
+            for (size_t g = 0; g < nGroups; ++g) {
+                __mmask8 high = _mm512_cmp_pd_mask(t, _mm512_set1_pd(groupTmid[g]), _CMP_GT_OQ);
+                const double* cl = coeffs + g * 12 * stride + l;
+                const double* ch = cl + 6 * stride;
+                __m512d c[6];
+                for (int j = 0; j < 6; ++j) {
+                    c[j] = _mm512_mask_blend_pd(high, _mm512_loadu_pd(cl + j * stride), _mm512_loadu_pd(ch + j * stride));
+                }
+                __m512d h = _mm512_fmadd_pd(t, c[5], c[4]);
+                h = _mm512_fmadd_pd(t, h, c[3]);
+                h = _mm512_fmadd_pd(t, h, c[2]);
+                h = _mm512_fmadd_pd(t, h, c[1]);
+                H = _mm512_add_pd(H, _mm512_fmadd_pd(t, h, c[0]));
+
+                __m512d d = _mm512_fmadd_pd(t, _mm512_mul_pd(five, c[5]), _mm512_mul_pd(four, c[4]));
+                d = _mm512_fmadd_pd(t, d, _mm512_mul_pd(three, c[3]));
+                d = _mm512_fmadd_pd(t, d, _mm512_mul_pd(two, c[2]));
+                cp = _mm512_add_pd(cp, _mm512_fmadd_pd(t, d, c[1]));
+
+                __m512d d2 = _mm512_fmadd_pd(t, _mm512_mul_pd(twenty, c[5]), _mm512_mul_pd(twelve, c[4]));
+                d2 = _mm512_fmadd_pd(t, d2, _mm512_mul_pd(six, c[3]));
+                dcp = _mm512_add_pd(dcp, _mm512_fmadd_pd(t, d2, _mm512_mul_pd(two, c[2])));
+            }
+
+            __m512d r = _mm512_sub_pd(H, tgt);
+            __mmask8 exact = _mm512_mask_cmp_pd_mask(active, r, zero, _CMP_EQ_OQ);
+            __mmask8 below = _mm512_mask_cmp_pd_mask(active, r, zero, _CMP_LT_OQ);
+            lo = _mm512_mask_mov_pd(lo, below, t);
+            hi = _mm512_mask_mov_pd(hi, active & static_cast<__mmask8>(~below), t);
+
+            // Halley修正的Newton步; 导数异常或越出区间的通道二分
+            __m512d step = _mm512_div_pd(r, cp);
+            __m512d correction = _mm512_fnmadd_pd(_mm512_mul_pd(half, step), _mm512_div_pd(dcp, cp), one);
+            step = _mm512_mask_div_pd(step, _mm512_cmp_pd_mask(correction, half, _CMP_GT_OQ), step, correction);
+            __m512d tn = _mm512_sub_pd(t, step);
+            __mmask8 small = _mm512_cmp_pd_mask(_mm512_abs_pd(step), _mm512_mul_pd(stepTol, t), _CMP_LE_OQ);
+            __mmask8 newton = _mm512_cmp_pd_mask(cp, zero, _CMP_GT_OQ) & (small |
+                (_mm512_cmp_pd_mask(tn, lo, _CMP_GT_OQ) & _mm512_cmp_pd_mask(tn, hi, _CMP_LT_OQ)));
+            __m512d mid = _mm512_mul_pd(half, _mm512_add_pd(lo, hi));
+            tn = _mm512_mask_blend_pd(newton, mid, tn);
+
+            // 步长小于容差时直接接受 (舍入后可能落在区间端点上)
+            __mmask8 stepDone = newton & small;
+            __mmask8 widthDone = static_cast<__mmask8>(~newton) & _mm512_cmp_pd_mask(_mm512_sub_pd(hi, lo),
+                _mm512_mul_pd(widthTol, mid), _CMP_LE_OQ);
+            __mmask8 boundary = _mm512_cmp_pd_mask(lo, vTmin, _CMP_EQ_OQ) | _mm512_cmp_pd_mask(hi, vTmax, _CMP_EQ_OQ);
+            failed |= active & widthDone & boundary & static_cast<__mmask8>(~exact);
+
+            tn = _mm512_mask_mov_pd(tn, exact, t);
+            t = _mm512_mask_mov_pd(t, active, tn);
+            count = _mm512_mask_add_pd(count, active, count, one);
+            active &= static_cast<__mmask8>(~(stepDone | widthDone | exact));
+        }
+        failed |= active;
+
+        _mm512_storeu_pd(T + l, _mm512_mask_mov_pd(_mm512_loadu_pd(T + l), lanes, t));
+        alignas(64) double counts[8];
+        _mm512_store_pd(counts, count);
+        for (size_t j = 0; j < 8 && l + j < n; ++j) {
+            iterations[l + j] = (failed >> j) & 1 ? maxIterations + 1 : static_cast<int>(counts[j]);
+        }
+    }
+}
@@ -0,0 +1,184 @@
+#include "ThermoPrecision.h"
+#include "IdealGasPhase.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+// ThermoEvaluator 实现
+
+template <typename Real, typename Acc>
+ThermoEvaluator<Real, Acc>::ThermoEvaluator(std::shared_ptr<const SpeciesThermo> species)
+    : m_species(std::move(species)) {
+    if (!m_species) {
+        throw std::invalid_argument("ThermoEvaluator: species thermo is null");
+    }
+    // 系数表由原始数据重新建立 (单精度时在双精度下预除后舍入)
+    m_table = BasicNasa7Table<Real>(m_species->species());
+    size_t nsp = m_species->nSpecies();
+    m_h.resize(nsp);
+    m_s.resize(nsp);
+    m_cp.resize(nsp);
+    m_mw.resize(nsp);
+    for (size_t k = 0; k < nsp; ++k) m_mw[k] = static_cast<Real>(m_species->molecularWeights()[k]);
+    m_nasa9.resize(3 * m_species->nasa9().nSpecies());
+}
+
+template <typename Real, typename Acc>
+void ThermoEvaluator<Real, Acc>::update(double T) {
+    if (T == m_T) return;
+    m_T = T;
+    if (m_table.nSpecies() > 0) {
+        ThermoKernels::evaluate(m_table, T, m_h.data(), m_s.data(), m_cp.data());
+    }
+
+    const Nasa9Table& nasa9 = m_species->nasa9();
+    size_t n9 = nasa9.nSpecies();
+    if (n9 > 0) {
+        double* h9 = m_nasa9.data();
+        ThermoKernels::evaluate(nasa9, T, h9, h9 + n9, h9 + 2 * n9);
+        for (size_t j = 0; j < n9; ++j) {
+            size_t k = nasa9.speciesIndex(j);
+            m_h[k] = static_cast<Real>(h9[j]);
+            m_s[k] = static_cast<Real>(h9[n9 + j]);
+            m_cp[k] = static_cast<Real>(h9[2 * n9 + j]);
+        }
+    }
+}
+
+template <typename Real, typename Acc>
+Acc ThermoEvaluator<Real, Acc>::sum(const Real* X, const Real* f) const {
+    Acc result = 0;
+    for (size_t k = 0; k < nSpecies(); ++k) {
+        result += static_cast<Acc>(X[k]) * static_cast<Acc>(f[k]);
+    }
+    return result;
+}
+
+template <typename Real, typename Acc>
+Acc ThermoEvaluator<Real, Acc>::cp_mole(const Real* X) const {
+    return static_cast<Acc>(GasConstant) * sum(X, m_cp.data());
+}
+
+template <typename Real, typename Acc>
+Acc ThermoEvaluator<Real, Acc>::enthalpy_mole(const Real* X) const {
+    return static_cast<Acc>(GasConstant * m_T) * sum(X, m_h.data());
+}
+
+template <typename Real, typename Acc>
+Acc ThermoEvaluator<Real, Acc>::entropy_mole(const Real* X, double P) const {
+    // s = R (Σ X_k (s_k/R - ln X_k) - ln(P/P0)), 摩尔分数为0的组分没有混合熵项
+    Acc s = 0;
+    for (size_t k = 0; k < nSpecies(); ++k) {
+        if (X[k] > 0) {
+            s += static_cast<Acc>(X[k]) * (static_cast<Acc>(m_s[k]) - std::log(static_cast<Acc>(X[k])));
+        }
+    }
+    return static_cast<Acc>(GasConstant) * (s - static_cast<Acc>(std::log(P / OneAtm)));
+}
+
+template class ThermoEvaluator<double>;
+template class ThermoEvaluator<float>;
+template class ThermoEvaluator<float, double>;
+
+// PrecisionReport 实现
+
+template <typename Real, typename Acc>
+PrecisionReport precisionReport(std::shared_ptr<const SpeciesThermo> species, double Tmin, double Tmax, double dT) {
+    ThermoEvaluator<Real, Acc> evaluator(species);
+    ThermoEvaluator<double> reference(species);
+    size_t nsp = species->nSpecies();
+    ThermoWorkspace work;
+    work.resize(nsp);
+    std::vector<double> h(nsp), s(nsp), cp(nsp);
+    std::vector<Real> X(nsp, static_cast<Real>(1.0 / nsp));
+    std::vector<double> Xd(nsp, 1.0 / nsp);
+
+    PrecisionReport report;
+    report.Tmin = Tmin;
+    report.Tmax = Tmax;
+    report.species.resize(nsp);
+    std::vector<double> worstTotal(nsp, 0.0);
+    for (size_t k = 0; k < nsp; ++k) report.species[k].name = species->species(k).name;
+
+    auto error = [](double value, double exact) { return std::abs(value - exact) / std::max(std::abs(exact), 1.0); };
+    size_t nT = static_cast<size_t>(std::floor((Tmax - Tmin) / dT + 0.5)) + 1;
+    for (size_t i = 0; i < nT; ++i) {
+        double T = std::min(Tmin + i * dT, Tmax);
+        species->evaluate(T, h.data(), s.data(), cp.data(), work);
+        evaluator.update(T);
+        for (size_t k = 0; k < nsp; ++k) {
+            PrecisionReport::Entry& e = report.species[k];
+            double eh = error(evaluator.h_RT()[k], h[k]);
+            double es = error(evaluator.s_R()[k], s[k]);
+            double ec = error(evaluator.cp_R()[k], cp[k]);
+            e.h_RT = std::max(e.h_RT, eh);
+            e.s_R = std::max(e.s_R, es);
+            e.cp_R = std::max(e.cp_R, ec);
+            double total = std::max(eh, std::max(es, ec));
+            if (total > worstTotal[k]) {
+                worstTotal[k] = total;
+                e.Tworst = T;
+            }
+        }
+
+        // 等摩尔混合物的比性质, 双精度参考值由同样的求和得到
+        reference.update(T);
+        double mw = reference.meanMolecularWeight(Xd.data());
+        double hScale = GasConstant * T / mw;
+        report.cp_mass = std::max(report.cp_mass,
+            error(evaluator.cp_mass(X.data()) / (GasConstant / mw), reference.cp_mass(Xd.data()) / (GasConstant / mw)));
+        report.enthalpy_mass = std::max(report.enthalpy_mass,
+            error(evaluator.enthalpy_mass(X.data()) / hScale, reference.enthalpy_mass(Xd.data()) / hScale));
+        report.entropy_mass = std::max(report.entropy_mass,
+            error(evaluator.entropy_mass(X.data(), OneAtm) / (GasConstant / mw),
+                reference.entropy_mass(Xd.data(), OneAtm) / (GasConstant / mw)));
+    }
+
+    double worst = -1.0;
+    for (size_t k = 0; k < nsp; ++k) {
+        const PrecisionReport::Entry& e = report.species[k];
+        report.worst.h_RT = std::max(report.worst.h_RT, e.h_RT);
+        report.worst.s_R = std::max(report.worst.s_R, e.s_R);
+        report.worst.cp_R = std::max(report.worst.cp_R, e.cp_R);
+        if (worstTotal[k] > worst) {
+            worst = worstTotal[k];
+            report.worst.name = e.name;
+            report.worst.Tworst = e.Tworst;
+        }
+    }
+    return report;
+}
+
+template PrecisionReport precisionReport<double, double>(std::shared_ptr<const SpeciesThermo>, double, double, double);
+template PrecisionReport precisionReport<float, float>(std::shared_ptr<const SpeciesThermo>, double, double, double);
+template PrecisionReport precisionReport<float, double>(std::shared_ptr<const SpeciesThermo>, double, double, double);
+
+std::string PrecisionReport::str(size_t nRows) const {
+    std::vector<const Entry*> rows;
+    for (const Entry& e : species) rows.push_back(&e);
+    if (nRows > 0 && nRows < rows.size()) {
+        auto total = [](const Entry* e) { return std::max(e->h_RT, std::max(e->s_R, e->cp_R)); };
+        std::partial_sort(rows.begin(), rows.begin() + nRows, rows.end(),
+            [&total](const Entry* a, const Entry* b) { return total(a) > total(b); });
+        rows.resize(nRows);
+    }
+
+    std::ostringstream oss;
+    oss << "  max relative error vs double, " << Tmin << "-" << Tmax << " K\n";
+    oss << "  " << std::left << std::setw(16) << "species" << std::right << std::setw(11) << "h/RT"
+        << std::setw(11) << "s/R" << std::setw(11) << "cp/R" << std::setw(9) << "at T" << "\n";
+    oss << std::scientific << std::setprecision(2);
+    for (const Entry* e : rows) {
+        oss << "  " << std::left << std::setw(16) << e->name << std::right << std::setw(11) << e->h_RT
+            << std::setw(11) << e->s_R << std::setw(11) << e->cp_R
+            << std::fixed << std::setprecision(0) << std::setw(9) << e->Tworst
+            << std::scientific << std::setprecision(2) << "\n";
+    }
+    oss << "  " << std::left << std::setw(16) << "all species" << std::right << std::setw(11) << worst.h_RT
+        << std::setw(11) << worst.s_R << std::setw(11) << worst.cp_R << "  (worst: " << worst.name << ")\n";
+    oss << "  equimolar mixture: cp_mass " << cp_mass << ", enthalpy_mass " << enthalpy_mass
+        << ", entropy_mass " << entropy_mass << "\n";
+    return oss.str();
+}
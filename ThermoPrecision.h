@@ -0,0 +1,81 @@
+#pragma once
+#include "SpeciesThermo.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+// 单精度/混合精度热力学求值 - 系数表、NASA7内核、混合物求和按数值类型模板化
+// Real: 系数表和组分性质的类型; Acc: 混合物求和 (Σ X_k f_k) 的累加类型和返回类型
+//   ThermoEvaluator<double>         与IdealGasPhase相同的双精度路径
+//   ThermoEvaluator<float>          全单精度: 系数表内存减半, 一个SIMD寄存器处理两倍的组分
+//   ThermoEvaluator<float, double>  混合精度: 单精度组分性质, 双精度累加 (混合物焓的相消误差不放大)
+// NASA9组分总是用双精度内核计算后舍入到Real; 对象保存求值结果, 每个线程使用自己的对象
+template <typename Real, typename Acc = Real>
+class ThermoEvaluator {
+public:
+    explicit ThermoEvaluator(std::shared_ptr<const SpeciesThermo> species);
+
+    size_t nSpecies() const { return m_species->nSpecies(); }
+    const std::shared_ptr<const SpeciesThermo>& speciesThermo() const { return m_species; }
+
+    // 计算全部组分的参考态性质 (温度未变时直接返回)
+    void update(double T);
+    double temperature() const { return m_T; }
+    const Real* h_RT() const { return m_h.data(); }
+    const Real* s_R() const { return m_s.data(); }
+    const Real* cp_R() const { return m_cp.data(); }
+    const Real* molecularWeights() const { return m_mw.data(); }
+
+    // 混合物性质 (当前温度), X为归一化的摩尔分数, 长度nSpecies
+    Acc meanMolecularWeight(const Real* X) const { return sum(X, m_mw.data()); }   // kg/kmol
+    Acc cp_mole(const Real* X) const;                                               // J/(kmol·K)
+    Acc enthalpy_mole(const Real* X) const;                                         // J/kmol
+    Acc entropy_mole(const Real* X, double P) const;                                // J/(kmol·K), P: Pa
+    Acc cp_mass(const Real* X) const { return cp_mole(X) / meanMolecularWeight(X); }
+    Acc enthalpy_mass(const Real* X) const { return enthalpy_mole(X) / meanMolecularWeight(X); }
+    Acc entropy_mass(const Real* X, double P) const { return entropy_mole(X, P) / meanMolecularWeight(X); }
+
+private:
+    // Σ X_k f_k, 以Acc累加
+    Acc sum(const Real* X, const Real* f) const;
+
+    std::shared_ptr<const SpeciesThermo> m_species;
+    BasicNasa7Table<Real> m_table;
+    AlignedVector<Real> m_h;
+    AlignedVector<Real> m_s;
+    AlignedVector<Real> m_cp;
+    std::vector<Real> m_mw;
+    std::vector<double> m_nasa9;                // NASA9组分的双精度结果 (h/RT, s/R, cp/R)
+    double m_T = -1.0;
+};
+
+typedef ThermoEvaluator<double> ThermoEvaluatorF64;
+typedef ThermoEvaluator<float> ThermoEvaluatorF32;
+typedef ThermoEvaluator<float, double> ThermoEvaluatorMixed;
+
+// 相对于双精度路径 (SpeciesThermo::evaluate) 的精度报告
+// 误差为 |f - f_double| / max(|f_double|, 1) 在温度网格上的最大值; 混合物为等摩尔混合物的比性质,
+// 焓按 h/RT 计量 (与组分的误差可比, 焓在零点附近不放大)
+struct PrecisionReport {
+    struct Entry {
+        std::string name;
+        double h_RT = 0.0;
+        double s_R = 0.0;
+        double cp_R = 0.0;
+        double Tworst = 0.0;                    // 三个误差中最大者所在的温度
+    };
+    std::vector<Entry> species;
+    Entry worst;                                // 各列分别取全部组分的最大值, name为总误差最大的组分
+    double cp_mass = 0.0;
+    double enthalpy_mass = 0.0;
+    double entropy_mass = 0.0;
+    double Tmin = 0.0;
+    double Tmax = 0.0;
+
+    // 表格: 每个组分一行 (nRows > 0 时只列出误差最大的nRows个组分), 最后是混合物
+    std::string str(size_t nRows = 0) const;
+};
+
+template <typename Real, typename Acc>
+PrecisionReport precisionReport(std::shared_ptr<const SpeciesThermo> species, double Tmin = 300.0,
+    double Tmax = 3000.0, double dT = 1.0);
@@ -0,0 +1,174 @@
+#include "ThermoTable.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+const double kDerivativeStep = 0.01;       // cp导数的差分步长 K (不超过单元宽度的1/4)
+
+} // namespace
+
+ThermoTable::ThermoTable(size_t nSpecies, const Evaluator& exact, const Options& options)
+    : m_nSpecies(nSpecies), m_order(options.interpolation == Interpolation::Cubic ? 4 : 2) {
+    if (!(options.Tmin > 0.0) || !(options.Tmax > options.Tmin)) {
+        throw std::invalid_argument("ThermoTable: invalid temperature range");
+    }
+    if (!(options.relTol > 0.0)) {
+        throw std::invalid_argument("ThermoTable: relative tolerance must be positive");
+    }
+
+    // 段边界: 范围内的分界温度去重排序
+    m_bounds.push_back(options.Tmin);
+    std::vector<double> breaks = options.breakpoints;
+    std::sort(breaks.begin(), breaks.end());
+    for (double B : breaks) {
+        if (B > m_bounds.back() && B < options.Tmax) m_bounds.push_back(B);
+    }
+    m_bounds.push_back(options.Tmax);
+
+    // 按插值阶数估计需要的网格宽度, 每次至少加密1/4, 避免逐次加倍带来的过度加密
+    size_t nSegments = m_bounds.size() - 1;
+    size_t maxIntervals = std::max(nSegments, options.maxIntervals);
+    double spacing = (options.Tmax - options.Tmin) / 64.0;
+    double accuracyOrder = m_order == 4 ? 4.0 : 2.0;
+    bool atLimit = false;
+    while (true) {
+        build(exact, spacing);
+        m_maxError = checkError(exact);
+        if (m_maxError <= options.relTol || atLimit) break;
+
+        double refine = std::max(1.25, std::pow(m_maxError / options.relTol, 1.0 / accuracyOrder) * 1.1);
+        spacing /= refine;
+        // 达到上限时用允许的最细网格
+        double cells = 0.0;
+        for (size_t s = 0; s < nSegments; ++s) cells += std::ceil((m_bounds[s + 1] - m_bounds[s]) / spacing);
+        if (cells >= maxIntervals) {
+            spacing = (options.Tmax - options.Tmin) / static_cast<double>(maxIntervals - nSegments);
+            atLimit = true;
+        }
+    }
+}
+
+void ThermoTable::endpoint(const Evaluator& exact, double T, int side, double step, double* value, double* slope) const {
+    size_t nsp = m_nSpecies;
+    exact(T, value, value + nsp, value + 2 * nsp);
+    if (m_order != 4) return;
+
+    // d(h/RT)/dT = (cp/R - h/RT)/T, d(s/R)/dT = (cp/R)/T; cp的导数用单元内侧的二阶单侧差分
+    std::vector<double> f1(3 * nsp), f2(3 * nsp);
+    exact(T + side * step, f1.data(), f1.data() + nsp, f1.data() + 2 * nsp);
+    exact(T + 2 * side * step, f2.data(), f2.data() + nsp, f2.data() + 2 * nsp);
+    for (size_t k = 0; k < nsp; ++k) {
+        double cp = value[2 * nsp + k];
+        slope[k] = (cp - value[k]) / T;
+        slope[nsp + k] = cp / T;
+        slope[2 * nsp + k] = side * (-3.0 * cp + 4.0 * f1[2 * nsp + k] - f2[2 * nsp + k]) / (2.0 * step);
+    }
+}
+
+void ThermoTable::build(const Evaluator& exact, double spacing) {
+    size_t nSegments = m_bounds.size() - 1;
+    m_segStart.assign(nSegments, 0);
+    m_segCells.assign(nSegments, 0);
+    m_segInvDT.assign(nSegments, 0.0);
+    m_nIntervals = 0;
+    for (size_t s = 0; s < nSegments; ++s) {
+        double length = m_bounds[s + 1] - m_bounds[s];
+        m_segStart[s] = m_nIntervals;
+        m_segCells[s] = std::max<size_t>(1, static_cast<size_t>(std::ceil(length / spacing)));
+        m_segInvDT[s] = m_segCells[s] / length;
+        m_nIntervals += m_segCells[s];
+    }
+
+    size_t nsp = m_nSpecies;
+    m_coeffs.assign(m_nIntervals * 3 * m_order * nsp, 0.0);
+    std::vector<double> y0(3 * nsp), y1(3 * nsp), d0(3 * nsp), d1(3 * nsp);
+    for (size_t s = 0; s < nSegments; ++s) {
+        double dT = 1.0 / m_segInvDT[s];
+        double step = std::min(kDerivativeStep, 0.25 * dT);
+        for (size_t local = 0; local < m_segCells[s]; ++local) {
+            // 段的左端取右极限, 右端即分界温度本身 (T > B 不成立, 仍属本段)
+            double TL = m_bounds[s] + local * dT;
+            if (local == 0) TL = std::nextafter(m_bounds[s], std::numeric_limits<double>::max());
+            double TR = local + 1 == m_segCells[s] ? m_bounds[s + 1] : m_bounds[s] + (local + 1) * dT;
+            endpoint(exact, TL, +1, step, y0.data(), d0.data());
+            endpoint(exact, TR, -1, step, y1.data(), d1.data());
+
+            // 单元内局部坐标 u = (T - TL)/dT ∈ [0, 1]
+            double* cell = m_coeffs.data() + (m_segStart[s] + local) * 3 * m_order * nsp;
+            for (size_t p = 0; p < 3; ++p) {
+                double* c = cell + p * m_order * nsp;
+                for (size_t k = 0; k < nsp; ++k) {
+                    size_t j = p * nsp + k;
+                    if (m_order == 2) {
+                        c[k] = y0[j];
+                        c[nsp + k] = y1[j] - y0[j];
+                        continue;
+                    }
+                    double m0 = d0[j] * dT;
+                    double m1 = d1[j] * dT;
+                    c[k] = y0[j];
+                    c[nsp + k] = m0;
+                    c[2 * nsp + k] = 3.0 * (y1[j] - y0[j]) - 2.0 * m0 - m1;
+                    c[3 * nsp + k] = 2.0 * (y0[j] - y1[j]) + m0 + m1;
+                }
+            }
+        }
+    }
+}
+
+double ThermoTable::checkError(const Evaluator& exact) const {
+    size_t nsp = m_nSpecies;
+    std::vector<double> ref(3 * nsp), approx(3 * nsp);
+    const double points[] = { 0.25, 0.5, 0.75 };
+    double maxErr = 0.0;
+    for (size_t s = 0; s + 1 < m_bounds.size(); ++s) {
+        double dT = 1.0 / m_segInvDT[s];
+        for (size_t local = 0; local < m_segCells[s]; ++local) {
+            for (double u : points) {
+                double T = m_bounds[s] + (local + u) * dT;
+                exact(T, ref.data(), ref.data() + nsp, ref.data() + 2 * nsp);
+                evaluate(T, approx.data(), approx.data() + nsp, approx.data() + 2 * nsp);
+                for (size_t j = 0; j < 3 * nsp; ++j) {
+                    maxErr = std::max(maxErr, std::abs(approx[j] - ref[j]) / std::max(std::abs(ref[j]), 1.0));
+                }
+            }
+        }
+    }
+    return maxErr;
+}
+
+void ThermoTable::evaluate(double T, double* h_RT, double* s_R, double* cp_R) const {
+    // 段号 = 低于T的分界温度个数; 段内单元号截断取整后夹在 [0, n-1]
+    size_t s = 0;
+    for (size_t b = 1; b + 1 < m_bounds.size(); ++b) {
+        s += T > m_bounds[b] ? 1 : 0;
+    }
+    double x = (T - m_bounds[s]) * m_segInvDT[s];
+    double clamped = std::min(std::max(x, 0.0), static_cast<double>(m_segCells[s] - 1));
+    size_t local = static_cast<size_t>(clamped);
+    double u = x - static_cast<double>(local);
+
+    size_t nsp = m_nSpecies;
+    const double* cell = m_coeffs.data() + (m_segStart[s] + local) * 3 * m_order * nsp;
+    double* out[3] = { h_RT, s_R, cp_R };
+    for (size_t p = 0; p < 3; ++p) {
+        const double* c0 = cell + p * m_order * nsp;
+        const double* c1 = c0 + nsp;
+        double* y = out[p];
+        if (m_order == 4) {
+            const double* c2 = c1 + nsp;
+            const double* c3 = c2 + nsp;
+            for (size_t k = 0; k < nsp; ++k) {
+                y[k] = c0[k] + u * (c1[k] + u * (c2[k] + u * c3[k]));
+            }
+        }
+        else {
+            for (size_t k = 0; k < nsp; ++k) {
+                y[k] = c0[k] + u * c1[k];
+            }
+        }
+    }
+}
@@ -0,0 +1,68 @@
+#pragma once
+#include "AlignedAllocator.h"
+#include <functional>
+#include <vector>
+
+// 热力学性质插值表 - 在温度网格上预先计算全部组分的 h/RT、s/R、cp/R
+// 每个网格单元保存分段多项式系数 (三次Hermite或线性), 求值时只需几次FMA, 不再计算多项式和ln(T)
+// 网格间距按给定的相对误差自动选择; 所有组分共用一个网格, 单元号每个温度只算一次
+// NASA多项式在区间分界温度处通常不连续, 网格在这些温度处断开: 相邻分界温度之间为均匀网格,
+// 段号为低于T的分界温度个数, 单元号为截断取整, 查找都不需要分支
+// 布局: [cell][property][order][nSpecies], 同一单元内按组分连续, 求值循环可以向量化
+class ThermoTable {
+public:
+    enum class Interpolation {
+        Linear,
+        Cubic       // 端点取值和导数都与原函数一致的三次Hermite插值
+    };
+
+    struct Options {
+        double Tmin = 300.0;                    // 网格范围 K
+        double Tmax = 3000.0;
+        double relTol = 1e-6;                   // 目标误差 |近似-精确| / max(|精确|, 1)
+        Interpolation interpolation = Interpolation::Cubic;
+        size_t maxIntervals = 1 << 16;          // 网格加密的上限
+        std::vector<double> breakpoints;        // 系数分段温度 (如NASA7的Tmid), 范围外的忽略
+    };
+
+    // 精确求值函数: 输出长度为nSpecies的 h/RT、s/R、cp/R
+    // 在分界温度B处按 T > B 使用上一段的规则求值
+    typedef std::function<void(double T, double* h_RT, double* s_R, double* cp_R)> Evaluator;
+
+    ThermoTable() = default;
+    // 从64个单元开始按收敛阶估计逐次加密, 直到每个单元1/4、1/2、3/4处的误差都不超过relTol
+    // Tmin >= Tmax 或 relTol <= 0 时抛出 std::invalid_argument
+    ThermoTable(size_t nSpecies, const Evaluator& exact, const Options& options);
+
+    size_t nSpecies() const { return m_nSpecies; }
+    size_t nIntervals() const { return m_nIntervals; }
+    size_t nSegments() const { return m_segCells.size(); }
+    double Tmin() const { return m_bounds.empty() ? 0.0 : m_bounds.front(); }
+    double Tmax() const { return m_bounds.empty() ? 0.0 : m_bounds.back(); }
+    Interpolation interpolation() const { return m_order == 4 ? Interpolation::Cubic : Interpolation::Linear; }
+
+    // 建表时在检查点上得到的最大误差 (达到maxIntervals时可能大于relTol)
+    double maxError() const { return m_maxError; }
+    size_t memoryUsage() const { return m_coeffs.size() * sizeof(double); }
+
+    bool contains(double T) const { return !m_bounds.empty() && T >= m_bounds.front() && T <= m_bounds.back(); }
+
+    // 插值求值, T超出范围时按边界单元的多项式外推 (调用者应先检查contains)
+    void evaluate(double T, double* h_RT, double* s_R, double* cp_R) const;
+
+private:
+    void build(const Evaluator& exact, double spacing);
+    double checkError(const Evaluator& exact) const;
+    // 单元端点的取值和导数 (side = +1 为单元左端, 从右侧取极限; -1 为右端)
+    void endpoint(const Evaluator& exact, double T, int side, double step, double* value, double* slope) const;
+
+    size_t m_nSpecies = 0;
+    size_t m_nIntervals = 0;
+    size_t m_order = 4;                         // 每个单元的系数个数
+    double m_maxError = 0.0;
+    std::vector<double> m_bounds;               // 段边界: Tmin, 分界温度..., Tmax
+    std::vector<size_t> m_segStart;             // 各段第一个单元的序号
+    std::vector<size_t> m_segCells;             // 各段单元数
+    std::vector<double> m_segInvDT;             // 各段单元宽度的倒数
+    AlignedVector<double> m_coeffs;
+};
@@ -0,0 +1,488 @@
+#include "IdealGasPhase.h"
+#include "MechanismView.h"
+#include "ThermoKernels.h"
+#include "ThermoTable.h"
+#include "ThermoBatch.h"
+#include "GasEquilibrium.h"
+#include "EquilibriumTable.h"
+#include "ThermoPrecision.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// 热力学内核基准测试
+// 对比原有的逐组分求值路径 (每个组分复制系数向量, 三次evaluateNASA) 与融合的SIMD内核
+// 用法: thermo_benchmark [mechanism.yaml]
+
+namespace {
+
+const size_t kEvaluationsPerCase = 4000000;     // 每种方法的组分求值总次数
+
+// 原有updateThermo的逐组分实现
+double legacyNASA(const std::vector<double>& coeffs, double T, int property) {
+    double T2 = T * T;
+    double T3 = T2 * T;
+    double T4 = T3 * T;
+    switch (property) {
+    case 0:
+        return coeffs[0] + coeffs[1] * T / 2.0 + coeffs[2] * T2 / 3.0 +
+            coeffs[3] * T3 / 4.0 + coeffs[4] * T4 / 5.0 + coeffs[5] / T;
+    case 1:
+        return coeffs[0] * std::log(T) + coeffs[1] * T + coeffs[2] * T2 / 2.0 +
+            coeffs[3] * T3 / 3.0 + coeffs[4] * T4 / 4.0 + coeffs[6];
+    default:
+        return coeffs[0] + coeffs[1] * T + coeffs[2] * T2 +
+            coeffs[3] * T3 + coeffs[4] * T4;
+    }
+}
+
+void legacyUpdate(const std::vector<ChemistryVars::ThermoData>& species, double T,
+    double* h_RT, double* s_R, double* cp_R) {
+    for (size_t i = 0; i < species.size(); ++i) {
+        const auto& thermo = species[i];
+        std::vector<double> coeffs;
+        if (thermo.temperatureRanges.size() >= 3 && !thermo.coefficients.high.empty()) {
+            coeffs = T <= thermo.temperatureRanges[1] ? thermo.coefficients.low : thermo.coefficients.high;
+        }
+        else {
+            coeffs = thermo.coefficients.low;
+        }
+        if (coeffs.size() >= 7) {
+            h_RT[i] = legacyNASA(coeffs, T, 0);
+            s_R[i] = legacyNASA(coeffs, T, 1);
+            cp_R[i] = legacyNASA(coeffs, T, 2);
+        }
+        else {
+            h_RT[i] = 0.0;
+            s_R[i] = 0.0;
+            cp_R[i] = 3.5;
+        }
+    }
+}
+
+// 复制机理中的组分得到指定数目的组分
+std::vector<ChemistryVars::ThermoData> replicate(const std::vector<ChemistryVars::ThermoData>& base, size_t n) {
+    std::vector<ChemistryVars::ThermoData> species;
+    species.reserve(n);
+    for (size_t k = 0; k < n; ++k) {
+        species.push_back(base[k % base.size()]);
+        if (k >= base.size()) species.back().name += "_" + std::to_string(k / base.size());
+    }
+    return species;
+}
+
+// 等价的三区间NASA9数据 (低温区间一分为二), 用于NASA9内核计时
+std::vector<ChemistryVars::ThermoData> toNasa9(const std::vector<ChemistryVars::ThermoData>& species) {
+    std::vector<ChemistryVars::ThermoData> result;
+    for (const auto& thermo : species) {
+        if (thermo.coefficients.low.size() != 7 || thermo.coefficients.high.size() != 7 ||
+            thermo.temperatureRanges.size() != 3) continue;
+        ChemistryVars::ThermoData nasa9 = thermo;
+        const double* T = thermo.temperatureRanges.data();
+        const double bounds[] = { T[0], 0.5 * (T[0] + T[1]), T[1], T[2] };
+        nasa9.model = "NASA9";
+        nasa9.coefficients.low.clear();
+        nasa9.coefficients.high.clear();
+        for (int r = 0; r < 3; ++r) {
+            const std::vector<double>& a = r < 2 ? thermo.coefficients.low : thermo.coefficients.high;
+            ChemistryVars::ThermoData::NASA9Range range;
+            range.temperatureRange = { bounds[r], bounds[r + 1] };
+            range.coefficients = { 0.0, 0.0, a[0], a[1], a[2], a[3], a[4], a[5], a[6] };
+            nasa9.nasa9Coeffs.push_back(range);
+        }
+        result.push_back(nasa9);
+    }
+    return result;
+}
+
+template <typename Func>
+double timeNsPerSpecies(size_t nSpecies, Func&& func) {
+    size_t iterations = std::max<size_t>(10, kEvaluationsPerCase / nSpecies);
+    func(0);    // 预热
+    auto start = std::chrono::steady_clock::now();
+    for (size_t it = 0; it < iterations; ++it) {
+        func(it);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return seconds * 1e9 / (static_cast<double>(iterations) * nSpecies);
+}
+
+// 每次调用都改变温度 (CFD中的典型情形)
+double sweepTemperature(size_t it) {
+    return 300.0 + static_cast<double>(it % 2700);
+}
+
+double maxRelativeError(const std::vector<double>& a, const std::vector<double>& b) {
+    double err = 0.0;
+    for (size_t k = 0; k < a.size(); ++k) {
+        err = std::max(err, std::abs(a[k] - b[k]) / std::max(1.0, std::abs(b[k])));
+    }
+    return err;
+}
+
+void runCase(const std::vector<ChemistryVars::ThermoData>& base, size_t n) {
+    std::vector<ChemistryVars::ThermoData> species = replicate(base, n);
+    Nasa7Table table(species);
+    std::vector<double> h(n), s(n), cp(n);
+    std::vector<double> hRef(n), sRef(n), cpRef(n);
+
+    ChemistryVars::MechanismData mechanism;
+    mechanism.thermoSpecies = species;
+    auto source = std::make_shared<const MechanismView::Source>(std::move(mechanism));
+    IdealGasPhase gas{ MechanismView(source) };
+    std::vector<double> x(n, 1.0 / n);
+    gas.setState_TPX(300.0, OneAtm, x.data());
+
+    std::cout << "\n" << n << " species" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+
+    double legacy = timeNsPerSpecies(n, [&](size_t it) {
+        legacyUpdate(species, sweepTemperature(it), hRef.data(), sRef.data(), cpRef.data());
+    });
+    std::cout << "  " << std::setw(22) << std::left << "legacy per-species" << std::right
+        << std::setw(8) << legacy << " ns/species" << std::endl;
+
+    volatile double sink = 0.0;
+    double phase = timeNsPerSpecies(n, [&](size_t it) {
+        gas.setTemperature(sweepTemperature(it));
+        sink = sink + gas.cp_mole();
+    });
+    std::cout << "  " << std::setw(22) << std::left << "IdealGasPhase::cp_mole" << std::right
+        << std::setw(8) << phase << " ns/species" << std::endl;
+
+    const ThermoKernels::Isa isas[] = { ThermoKernels::Isa::Scalar, ThermoKernels::Isa::AVX2, ThermoKernels::Isa::AVX512 };
+    for (ThermoKernels::Isa isa : isas) {
+        if (!ThermoKernels::isSupported(isa)) continue;
+        double t = timeNsPerSpecies(n, [&](size_t it) {
+            ThermoKernels::evaluate(isa, table, sweepTemperature(it), h.data(), s.data(), cp.data());
+        });
+
+        // 与原有路径比较精度
+        double err = 0.0;
+        for (double T = 300.0; T <= 3000.0; T += 137.0) {
+            legacyUpdate(species, T, hRef.data(), sRef.data(), cpRef.data());
+            ThermoKernels::evaluate(isa, table, T, h.data(), s.data(), cp.data());
+            err = std::max(err, std::max(maxRelativeError(h, hRef),
+                std::max(maxRelativeError(s, sRef), maxRelativeError(cp, cpRef))));
+        }
+
+        std::cout << "  " << std::setw(22) << std::left << (std::string("kernel ") + ThermoKernels::isaName(isa))
+            << std::right << std::setw(8) << t << " ns/species  speedup " << std::setw(6) << legacy / t
+            << "x  max rel. diff " << std::scientific << std::setprecision(1) << err
+            << std::fixed << std::setprecision(2) << std::endl;
+    }
+
+    // 单精度系数表: 每个SIMD寄存器处理两倍的组分, 误差相对于双精度内核
+    Nasa7TableF tableF(species);
+    std::vector<float> hF(n), sF(n), cpF(n);
+    for (ThermoKernels::Isa isa : isas) {
+        if (!ThermoKernels::isSupported(isa)) continue;
+        double t = timeNsPerSpecies(n, [&](size_t it) {
+            ThermoKernels::evaluate(isa, tableF, sweepTemperature(it), hF.data(), sF.data(), cpF.data());
+        });
+
+        double err = 0.0;
+        for (double T = 300.0; T <= 3000.0; T += 137.0) {
+            legacyUpdate(species, T, hRef.data(), sRef.data(), cpRef.data());
+            ThermoKernels::evaluate(isa, tableF, T, hF.data(), sF.data(), cpF.data());
+            for (size_t k = 0; k < n; ++k) {
+                err = std::max(err, std::abs(hF[k] - hRef[k]) / std::max(std::abs(hRef[k]), 1.0));
+                err = std::max(err, std::abs(sF[k] - sRef[k]) / std::max(std::abs(sRef[k]), 1.0));
+                err = std::max(err, std::abs(cpF[k] - cpRef[k]) / std::max(std::abs(cpRef[k]), 1.0));
+            }
+        }
+
+        std::cout << "  " << std::setw(22) << std::left << (std::string("float kernel ") + ThermoKernels::isaName(isa))
+            << std::right << std::setw(8) << t << " ns/species  speedup " << std::setw(6) << legacy / t
+            << "x  max rel. diff " << std::scientific << std::setprecision(1) << err
+            << std::fixed << std::setprecision(2) << std::endl;
+    }
+
+    // 插值表 (300-3000 K, 网格在各组分的Tmid处断开)
+    ThermoTable::Options options;
+    for (size_t k = 0; k < n; ++k) {
+        if (table.Tmid(k) < 1e300) options.breakpoints.push_back(table.Tmid(k));
+    }
+    const ThermoTable::Interpolation modes[] = { ThermoTable::Interpolation::Cubic, ThermoTable::Interpolation::Linear };
+    const double tolerances[] = { 1e-6, 1e-4 };
+    for (int m = 0; m < 2; ++m) {
+        options.interpolation = modes[m];
+        options.relTol = tolerances[m];
+        ThermoTable tab(n, [&](double T, double* hk, double* sk, double* cpk) {
+            ThermoKernels::evaluate(table, T, hk, sk, cpk);
+        }, options);
+        double t = timeNsPerSpecies(n, [&](size_t it) {
+            tab.evaluate(sweepTemperature(it), h.data(), s.data(), cp.data());
+        });
+        std::cout << "  " << std::setw(22) << std::left << (m == 0 ? "table cubic" : "table linear") << std::right
+            << std::setw(8) << t << " ns/species  speedup " << std::setw(6) << legacy / t << "x  tol "
+            << std::scientific << std::setprecision(0) << options.relTol << std::fixed << std::setprecision(2)
+            << ", " << tab.nIntervals() << " intervals, " << tab.memoryUsage() / 1024 << " KB" << std::endl;
+    }
+
+    // 同一组分的三区间NASA9形式
+    Nasa9Table table9(toNasa9(species));
+    size_t n9 = table9.nSpecies();
+    if (n9 == 0) return;
+    for (ThermoKernels::Isa isa : isas) {
+        if (!ThermoKernels::isSupported(isa)) continue;
+        double t = timeNsPerSpecies(n9, [&](size_t it) {
+            ThermoKernels::evaluate(isa, table9, sweepTemperature(it), h.data(), s.data(), cp.data());
+        });
+        std::cout << "  " << std::setw(22) << std::left << (std::string("NASA9 kernel ") + ThermoKernels::isaName(isa))
+            << std::right << std::setw(8) << t << " ns/species" << std::endl;
+    }
+}
+
+// 批量多状态计算: 逐状态调用setState_TPY和getter 与 ThermoBatch 比较
+void runBatch(const std::vector<ChemistryVars::ThermoData>& base) {
+    ChemistryVars::MechanismData mechanism;
+    mechanism.thermoSpecies = base;
+    IdealGasPhase gas{ MechanismView(std::make_shared<const MechanismView::Source>(std::move(mechanism))) };
+    ThermoBatch batch(gas);
+    size_t nsp = gas.nSpecies();
+    const size_t nStates = 200000;
+
+    std::vector<double> T(nStates), P(nStates, OneAtm), Y(nStates * nsp);
+    for (size_t i = 0; i < nStates; ++i) {
+        T[i] = sweepTemperature(i * 7);
+        for (size_t k = 0; k < nsp; ++k) Y[i * nsp + k] = 1.0 + (i + 3 * k) % 11;
+    }
+    std::vector<double> cp(nStates), h(nStates), mw(nStates);
+
+    std::cout << "\nBatch properties (" << nStates << " states, " << nsp << " species, cp/h/MW per state)" << std::endl;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < nStates; ++i) {
+        gas.setState_TPY(T[i], P[i], &Y[i * nsp]);
+        cp[i] = gas.cp_mass();
+        h[i] = gas.enthalpy_mass();
+        mw[i] = gas.meanMolecularWeight();
+    }
+    double single = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() * 1e9 / nStates;
+    std::cout << "  " << std::setw(22) << std::left << "IdealGasPhase per state" << std::right
+        << std::setw(8) << single << " ns/state" << std::endl;
+
+    // 输出程序的典型用法: 同一状态上连续调用8个getter
+    volatile double sink = 0.0;
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < nStates; ++i) {
+        gas.setState_TPY(T[i], P[i], &Y[i * nsp]);
+        sink = sink + gas.cp_mass() + gas.cv_mass() + gas.enthalpy_mass() + gas.intEnergy_mass() +
+            gas.entropy_mass() + gas.gibbs_mass() + gas.density() + gas.meanMolecularWeight();
+    }
+    double getters = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() * 1e9 / nStates;
+    std::cout << "  " << std::setw(22) << std::left << "8 getters per state" << std::right
+        << std::setw(8) << getters << " ns/state" << std::endl;
+
+    // 同样的性质由getProperties一次遍历得到
+    IdealGasPhase::Properties props;
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < nStates; ++i) {
+        gas.setState_TPY(T[i], P[i], &Y[i * nsp]);
+        gas.getProperties(props);
+        sink = sink + props.cp_mass + props.cv_mass + props.enthalpy_mass + props.intEnergy_mass +
+            props.entropy_mass + props.gibbs_mass + props.density + props.meanMolecularWeight;
+    }
+    double bundle = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() * 1e9 / nStates;
+    std::cout << "  " << std::setw(22) << std::left << "getProperties" << std::right
+        << std::setw(8) << bundle << " ns/state" << std::endl;
+
+    ThermoBatch::States states;
+    states.n = nStates;
+    states.T = T.data();
+    states.P = P.data();
+    states.Y = Y.data();
+    states.stateStride = nsp;
+    ThermoBatch::Properties out;
+    out.cp_mass = cp.data();
+    out.enthalpy_mass = h.data();
+    out.meanMolecularWeight = mw.data();
+
+    size_t threads[] = { 1, std::max(1u, std::thread::hardware_concurrency()) };
+    for (size_t nThreads : threads) {
+        start = std::chrono::steady_clock::now();
+        batch.evaluate(states, out, nThreads);
+        double t = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() * 1e9 / nStates;
+        std::cout << "  " << std::setw(22) << std::left << ("ThermoBatch " + std::to_string(nThreads) + " thread(s)")
+            << std::right << std::setw(8) << t << " ns/state  speedup " << std::setw(6) << single / t << "x" << std::endl;
+        if (threads[1] == 1) break;
+    }
+
+    // 由焓反求温度: 逐状态setState_HP 与 各指令集的批量反演比较 (初值偏离真值50 K)
+    std::vector<double> Tguess(nStates), Tout(nStates);
+    for (size_t i = 0; i < nStates; ++i) Tguess[i] = T[i] + (i % 2 ? 50.0 : -50.0);
+    std::cout << "\nBatch T(h) inversion (" << nStates << " states, guess off by 50 K)" << std::endl;
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < nStates; ++i) {
+        gas.setState_TPY(Tguess[i], P[i], &Y[i * nsp]);
+        gas.setState_HP(h[i], P[i]);
+        Tout[i] = gas.temperature();
+    }
+    single = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() * 1e9 / nStates;
+    std::cout << "  " << std::setw(22) << std::left << "setState_HP per state" << std::right
+        << std::setw(8) << single << " ns/state" << std::endl;
+
+    states.T = Tguess.data();
+    ThermoKernels::Isa previous = ThermoKernels::activeIsa();
+    const ThermoKernels::Isa isas[] = { ThermoKernels::Isa::Scalar, ThermoKernels::Isa::AVX2, ThermoKernels::Isa::AVX512 };
+    for (ThermoKernels::Isa isa : isas) {
+        if (!ThermoKernels::isSupported(isa)) continue;
+        ThermoKernels::setIsa(isa);
+        start = std::chrono::steady_clock::now();
+        ThermoBatch::InversionStats stats = batch.invertEnthalpy(states, h.data(), 1, Tout.data(), 1, 1);
+        double t = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() * 1e9 / nStates;
+        std::cout << "  " << std::setw(22) << std::left << (std::string("invertEnthalpy ") + ThermoKernels::isaName(isa))
+            << std::right << std::setw(8) << t << " ns/state  speedup " << std::setw(6) << single / t
+            << "x  mean iterations " << stats.meanIterations() << std::endl;
+    }
+    ThermoKernels::setIsa(previous);
+}
+
+// 化学平衡: 冷启动 (由当前组成估计初值) 与 沿当量比扫描的热启动, TP与HP
+void runEquilibrium(const std::vector<ChemistryVars::ThermoData>& base, size_t n) {
+    ChemistryVars::MechanismData mechanism;
+    mechanism.thermoSpecies = replicate(base, n);
+    IdealGasPhase gas{ MechanismView(std::make_shared<const MechanismView::Source>(std::move(mechanism))) };
+    const bool methane = gas.speciesIndex("CH4") != static_cast<size_t>(-1);
+    const std::string fuel = methane ? "CH4:" : "H2:";
+    const double oxygen = methane ? 2.0 : 0.5;
+    const int nSolves = 200;
+
+    std::cout << "\nEquilibrium (" << gas.nSpecies() << " species, " << fuel.substr(0, fuel.size() - 1)
+        << "/air, phi 0.8-1.2)" << std::endl;
+    const GasEquilibrium::Constraint constraints[] = { GasEquilibrium::Constraint::TP, GasEquilibrium::Constraint::HP };
+    for (GasEquilibrium::Constraint constraint : constraints) {
+        bool tp = constraint == GasEquilibrium::Constraint::TP;
+        for (int warm = 0; warm < 2; ++warm) {
+            GasEquilibrium::Options options;
+            options.warmStart = warm != 0;
+            GasEquilibrium solver(options);
+            double seconds = 0.0;
+            long iterations = 0;
+            for (int i = 0; i < nSolves; ++i) {
+                double phi = 0.8 + 0.4 * i / nSolves;
+                gas.setState_TPX(tp ? 2200.0 : 300.0, OneAtm,
+                    fuel + std::to_string(phi) + ", O2:" + std::to_string(oxygen) + ", N2:" + std::to_string(3.76 * oxygen));
+                auto start = std::chrono::steady_clock::now();
+                solver.equilibrate(gas, constraint);
+                seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                iterations += solver.iterations();
+            }
+            std::string label = std::string(tp ? "TP" : "HP") + (warm ? " warm start" : " cold start");
+            std::cout << "  " << std::setw(22) << std::left << label << std::right << std::setw(8)
+                << seconds * 1e6 / nSolves << " us/solve  mean iterations "
+                << static_cast<double>(iterations) / nSolves << std::endl;
+        }
+    }
+}
+
+// 平衡查找表: (Z, 焓亏损, 压力) 网格, 单线程与全部线程
+void runEquilibriumTable(const std::vector<ChemistryVars::ThermoData>& base) {
+    ChemistryVars::MechanismData mechanism;
+    mechanism.thermoSpecies = base;
+    IdealGasPhase gas{ MechanismView(std::make_shared<const MechanismView::Source>(std::move(mechanism))) };
+    const bool methane = gas.speciesIndex("CH4") != static_cast<size_t>(-1);
+    EquilibriumTable table(gas, methane ? "CH4:1" : "H2:1", 300.0, "O2:0.21, N2:0.79", 300.0);
+
+    EquilibriumTable::Grid grid;
+    for (int i = 0; i < 200; ++i) grid.Z.push_back(i / 199.0);
+    for (int i = 0; i < 10; ++i) grid.enthalpyDefect.push_back(-1e5 * i);
+    for (int i = 0; i < 5; ++i) grid.P.push_back(OneAtm * (1.0 + 4.0 * i));
+    size_t n = grid.nPoints();
+    std::vector<double> T(n), Y(n * gas.nSpecies());
+    EquilibriumTable::Output out;
+    out.T = T.data();
+    out.Y = Y.data();
+
+    std::cout << "\nEquilibrium table (" << n << " HP points, Z x enthalpy defect x P = "
+        << grid.Z.size() << " x " << grid.enthalpyDefect.size() << " x " << grid.P.size() << ")" << std::endl;
+    size_t threads[] = { 1, std::max(1u, std::thread::hardware_concurrency()) };
+    double single = 0.0;
+    for (size_t nThreads : threads) {
+        auto start = std::chrono::steady_clock::now();
+        EquilibriumTable::Stats stats = table.compute(grid, out, nThreads);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (nThreads == 1) single = seconds;
+        std::cout << "  " << std::setw(22) << std::left << (std::to_string(nThreads) + " thread(s)") << std::right
+            << std::setw(8) << seconds * 1e6 / n << " us/point  speedup " << std::setw(6) << single / seconds
+            << "x  mean iterations " << stats.meanIterations() << "  unreachable " << stats.nFailed
+            << "  steals " << stats.nSteals << std::endl;
+        if (threads[1] == 1) break;
+    }
+}
+
+// 单精度/混合精度相对于双精度的精度报告 (全部组分, 300-3000 K) 和混合物性质的耗时
+void runPrecision(const std::vector<ChemistryVars::ThermoData>& base) {
+    auto species = std::make_shared<const SpeciesThermo>(base);
+    std::cout << "\nPrecision: float (float accumulation)" << std::endl;
+    std::cout << precisionReport<float, float>(species).str();
+    std::cout << "Precision: mixed (float species, double accumulation)" << std::endl;
+    std::cout << precisionReport<float, double>(species).str(5);
+
+    std::vector<double> Xd(species->nSpecies(), 1.0 / species->nSpecies());
+    std::vector<float> Xf(Xd.begin(), Xd.end());
+    ThermoEvaluatorF64 f64(species);
+    ThermoEvaluatorF32 f32(species);
+    ThermoEvaluatorMixed mixed(species);
+    volatile double sink = 0.0;
+    std::cout << std::fixed << std::setprecision(2);
+    double t = timeNsPerSpecies(species->nSpecies(), [&](size_t it) {
+        f64.update(sweepTemperature(it));
+        sink = sink + f64.cp_mass(Xd.data()) + f64.enthalpy_mass(Xd.data());
+    });
+    std::cout << "  " << std::setw(22) << std::left << "double update+mix" << std::right
+        << std::setw(8) << t << " ns/species" << std::endl;
+    t = timeNsPerSpecies(species->nSpecies(), [&](size_t it) {
+        f32.update(sweepTemperature(it));
+        sink = sink + f32.cp_mass(Xf.data()) + f32.enthalpy_mass(Xf.data());
+    });
+    std::cout << "  " << std::setw(22) << std::left << "float update+mix" << std::right
+        << std::setw(8) << t << " ns/species" << std::endl;
+    t = timeNsPerSpecies(species->nSpecies(), [&](size_t it) {
+        mixed.update(sweepTemperature(it));
+        sink = sink + mixed.cp_mass(Xf.data()) + mixed.enthalpy_mass(Xf.data());
+    });
+    std::cout << "  " << std::setw(22) << std::left << "mixed update+mix" << std::right
+        << std::setw(8) << t << " ns/species" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string yamlFile = argc > 1 ? argv[1] : "mechanism.yaml";
+
+    try {
+        std::vector<ChemistryVars::ThermoData> base = ChemistryVars::extractThermo(yamlFile);
+        if (base.empty()) {
+            std::cerr << "No species in " << yamlFile << std::endl;
+            return 1;
+        }
+
+        std::cout << "Thermo kernel benchmark (" << yamlFile << ", " << base.size() << " base species)" << std::endl;
+        std::cout << "Detected ISA: " << ThermoKernels::isaName(ThermoKernels::detectIsa()) << std::endl;
+
+        const size_t sizes[] = { 26, 500, 5000 };
+        for (size_t n : sizes) {
+            runCase(base, n);
+        }
+        runBatch(base);
+        runPrecision(base);
+        const size_t equilibriumSizes[] = { base.size(), 500 };
+        for (size_t n : equilibriumSizes) {
+            runEquilibrium(base, n);
+        }
+        runEquilibriumTable(base);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
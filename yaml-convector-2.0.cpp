@@ -1,11 +1,68 @@
 ﻿#include "ChemistryVars.h"
 #include "ChemistryIO.h"
+#include "ThermoCodegen.h"
+#include <fstream>
 #include <iostream>
 #include <limits>
+#include <stdexcept>
+#include <string>
 #include "MechanismTest.h"
 
+// yaml_convector codegen <mechanism.yaml> <header.h> [--namespace name] [--test test.cpp]
+// 生成机理专用的热力学头文件; --test 同时生成与运行时路径比较的验证程序
+static int runCodegen(int argc, char** argv) {
+    const char* usage = "Usage: yaml_convector codegen <mechanism.yaml> <header.h> [--namespace name] [--test test.cpp]";
+    if (argc < 2) {
+        std::cerr << usage << std::endl;
+        return 1;
+    }
+    std::string yamlFile = argv[0];
+    std::string headerFile = argv[1];
+    std::string testFile;
+    ThermoCodegen::Options options;
+    options.namespaceName = ThermoCodegen::identifierFromPath(yamlFile);
+    options.source = yamlFile;
+    for (int i = 2; i < argc; i += 2) {
+        std::string flag = argv[i];
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for option: " << flag << "\n" << usage << std::endl;
+            return 1;
+        }
+        if (flag == "--namespace") options.namespaceName = argv[i + 1];
+        else if (flag == "--test") testFile = argv[i + 1];
+        else {
+            std::cerr << "Unknown option: " << flag << std::endl;
+            return 1;
+        }
+    }
 
-int main() {
+    try {
+        std::vector<ChemistryVars::ThermoData> species = ChemistryVars::extractThermo(yamlFile);
+        std::ofstream header(headerFile);
+        if (!header) throw std::runtime_error("cannot write " + headerFile);
+        header << ThermoCodegen::generateHeader(species, options);
+        if (!testFile.empty()) {
+            // 验证程序按文件名包含头文件, 两者放在同一目录或头文件目录在包含路径中
+            std::ofstream test(testFile);
+            if (!test) throw std::runtime_error("cannot write " + testFile);
+            size_t slash = headerFile.find_last_of("/\\");
+            test << ThermoCodegen::generateTest(species,
+                slash == std::string::npos ? headerFile : headerFile.substr(slash + 1), options);
+        }
+        std::cout << "Generated " << headerFile << " (" << species.size() << " species, namespace "
+            << options.namespaceName << ")" << std::endl;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1 && std::string(argv[1]) == "codegen") {
+        return runCodegen(argc - 2, argv + 2);
+    }
     
     std::string yamlFile = "D:\\mechanism.yaml";
     ChemistryVars::extractThermo(yamlFile, true);